@@ -0,0 +1,206 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+// Measures how many posts per second 8 producer threads get into a CooperativeThreadServiceHost, with a plain post and a busy polling
+// host as the baseline and PostWithWake with a host that sleeps until it is woken. The locked wake mode reproduces the PostWithWake
+// that took a mutex and copied the std::function callback on every post, so the before and after numbers come from the same run.
+// Build it in Release, the Debug numbers are not meaningful.
+
+#include "../Util/BenchmarkTimer.hpp"
+#include <Test2/Framework/Host/Cooperative/CooperativeThreadServiceHost.hpp>
+#include <boost/asio/post.hpp>
+#include <spdlog/spdlog.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  using namespace Test2;
+
+  constexpr std::size_t ProducerCount = 8;
+  constexpr std::size_t PostsPerProducer = 250000;
+  constexpr std::size_t TotalPosts = ProducerCount * PostsPerProducer;
+  constexpr std::size_t Repetitions = 5;
+
+  enum class PostMode
+  {
+    PlainPost,
+    LockedWake,
+    PostWithWake
+  };
+
+  /// @brief The wake path before it was made lock-free, every post locks the mutex, copies the callback and invokes it.
+  class LockedWake
+  {
+    std::function<void()> m_callback;
+    std::mutex m_mutex;
+
+  public:
+    void SetCallback(std::function<void()> callback)
+    {
+      std::lock_guard lock(m_mutex);
+      m_callback = std::move(callback);
+    }
+
+    template <typename Handler>
+    void PostWithWake(CooperativeThreadServiceHost& rHost, Handler&& handler)
+    {
+      boost::asio::post(rHost.GetExecutor(), std::forward<Handler>(handler));
+      std::function<void()> callback;
+      {
+        std::lock_guard lock(m_mutex);
+        callback = m_callback;
+      }
+      if (callback)
+      {
+        callback();
+      }
+    }
+  };
+
+  struct PostResult
+  {
+    /// @brief From releasing the producers until the host handled the last post.
+    std::chrono::nanoseconds Duration{};
+    std::uint64_t WakeCount{0};
+  };
+
+  PostResult MeasureOnce(const PostMode mode)
+  {
+    CooperativeThreadServiceHost host;
+    std::size_t handledCount = 0;
+
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    bool wakeSignaled = false;
+    std::atomic<std::uint64_t> wakeCount{0};
+    auto wake = [&]()
+    {
+      wakeCount.fetch_add(1, std::memory_order_relaxed);
+      {
+        std::lock_guard lock(wakeMutex);
+        wakeSignaled = true;
+      }
+      wakeCondition.notify_one();
+    };
+    LockedWake lockedWake;
+    if (mode == PostMode::PostWithWake)
+    {
+      host.SetWakeCallback(wake);
+    }
+    else if (mode == PostMode::LockedWake)
+    {
+      lockedWake.SetCallback(wake);
+    }
+
+    std::atomic<std::size_t> readyCount{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> producers;
+    producers.reserve(ProducerCount);
+    for (std::size_t i = 0; i < ProducerCount; ++i)
+    {
+      producers.emplace_back(
+        [&host, &lockedWake, &handledCount, &readyCount, &go, mode]()
+        {
+          auto handler = [&handledCount]() { ++handledCount; };
+          readyCount.fetch_add(1);
+          while (!go.load())
+          {
+            std::this_thread::yield();
+          }
+          for (std::size_t j = 0; j < PostsPerProducer; ++j)
+          {
+            if (mode == PostMode::PostWithWake)
+            {
+              host.PostWithWake(handler);
+            }
+            else if (mode == PostMode::LockedWake)
+            {
+              lockedWake.PostWithWake(host, handler);
+            }
+            else
+            {
+              boost::asio::post(host.GetExecutor(), handler);
+            }
+          }
+        });
+    }
+    while (readyCount.load() != ProducerCount)
+    {
+      std::this_thread::yield();
+    }
+
+    const auto start = BenchmarkClock::now();
+    go = true;
+    std::thread joiner(
+      [&producers]()
+      {
+        for (auto& producer : producers)
+        {
+          producer.join();
+        }
+      });
+
+    // The host thread drains the posts, polling continuously for plain posts and sleeping until woken otherwise
+    while (handledCount != TotalPosts)
+    {
+      if (mode != PostMode::PlainPost)
+      {
+        std::unique_lock lock(wakeMutex);
+        wakeCondition.wait(lock, [&wakeSignaled] { return wakeSignaled; });
+        wakeSignaled = false;
+      }
+      host.Poll();
+    }
+    const auto end = BenchmarkClock::now();
+    joiner.join();
+
+    host.SetWakeCallback(nullptr);
+    return {end - start, wakeCount.load()};
+  }
+
+  void Report(const char* const pName, const PostMode mode)
+  {
+    std::uint64_t wakeCount = 0;
+    auto measure = [mode, &wakeCount]
+    {
+      const PostResult result = MeasureOnce(mode);
+      wakeCount = result.WakeCount;
+      return result.Duration;
+    };
+    const std::chrono::duration<double> elapsed = MeasureMedian(Repetitions, measure);
+    std::printf("  %-30s %8.2f M posts/s, %llu wakes in the last run\n", pName, static_cast<double>(TotalPosts) / elapsed.count() / 1e6,
+                static_cast<unsigned long long>(wakeCount));
+  }
+}
+
+int main()
+{
+  // Every run creates a host, keep its lifetime logging out of the results
+  spdlog::set_level(spdlog::level::warn);
+
+  std::printf("%zu producer threads posting %zu handlers each, median of %zu runs\n", ProducerCount, PostsPerProducer, Repetitions);
+  Report("post, polling host", PostMode::PlainPost);
+  Report("locked wake, sleeping host", PostMode::LockedWake);
+  Report("PostWithWake, sleeping host", PostMode::PostWithWake);
+  return 0;
+}
@@ -0,0 +1,88 @@
+#ifndef BENCHMARK_HOST_PROVIDERBENCHMARKSERVICES_HPP
+#define BENCHMARK_HOST_PROVIDERBENCHMARKSERVICES_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Framework/Service/IService.hpp>
+#include <Test2/Framework/Service/IServiceControl.hpp>
+#include <Test2/Framework/Service/ProcessResult.hpp>
+#include <Test2/Framework/Service/ServiceCreateInfo.hpp>
+#include <Test2/Framework/Service/ServiceInitResult.hpp>
+#include <Test2/Framework/Service/ServiceShutdownResult.hpp>
+#include <boost/asio/awaitable.hpp>
+#include <cstddef>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace Test2
+{
+  /// @brief Service that does nothing, the provider benchmarks only measure the bookkeeping around it.
+  class BenchmarkServiceControl : public IServiceControl
+  {
+  public:
+    boost::asio::awaitable<ServiceInitResult> InitAsync(const ServiceCreateInfo& /*creationInfo*/) override
+    {
+      co_return ServiceInitResult::Success;
+    }
+
+    boost::asio::awaitable<ServiceShutdownResult> ShutdownAsync() override
+    {
+      co_return ServiceShutdownResult::Success;
+    }
+
+    ProcessResult Process() override
+    {
+      return ProcessResult::NoSleepLimit();
+    }
+  };
+
+  /// @brief A distinct interface type per index, so a benchmark can register thousands of different interfaces.
+  template <std::size_t TIndex>
+  struct BenchmarkInterface : public IService
+  {
+  };
+
+  namespace Detail
+  {
+    template <std::size_t... TIndices>
+    std::vector<const std::type_info*> GetBenchmarkInterfaceTypeInfos(std::index_sequence<TIndices...> /*indices*/)
+    {
+      return {&typeid(BenchmarkInterface<TIndices>)...};
+    }
+  }
+
+  /// @brief The type_info of BenchmarkInterface<0> to BenchmarkInterface<TCount - 1>.
+  template <std::size_t TCount>
+  std::vector<const std::type_info*> GetBenchmarkInterfaceTypeInfos()
+  {
+    return Detail::GetBenchmarkInterfaceTypeInfos(std::make_index_sequence<TCount>{});
+  }
+
+  /// @brief The type_index of BenchmarkInterface<0> to BenchmarkInterface<TCount - 1>.
+  template <std::size_t TCount>
+  std::vector<std::type_index> MakeBenchmarkInterfaceTypes()
+  {
+    const std::vector<const std::type_info*> typeInfos = GetBenchmarkInterfaceTypeInfos<TCount>();
+    std::vector<std::type_index> types;
+    types.reserve(typeInfos.size());
+    for (const std::type_info* const pTypeInfo : typeInfos)
+    {
+      types.emplace_back(*pTypeInfo);
+    }
+    return types;
+  }
+}
+
+#endif
@@ -0,0 +1,105 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+// Measures the latency of ManagedThreadServiceProvider type lookups with 10, 100 and 1000 registered services, each with an interface of
+// its own, looked up round-robin. Build it in Release, the Debug numbers are not meaningful.
+
+#include "../../../src/Test2/Framework/Host/Managed/ManagedThreadServiceProvider.hpp"
+#include "../Util/BenchmarkTimer.hpp"
+#include "ProviderBenchmarkServices.hpp"
+#include <Test2/Framework/Host/ServiceInstanceInfo.hpp>
+#include <Test2/Framework/Registry/ServiceLaunchPriority.hpp>
+#include <Test2/Framework/Service/IService.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+namespace
+{
+  using namespace Test2;
+
+  constexpr std::size_t MaxServiceCount = 1000;
+  constexpr std::size_t LookupCount = 1000000;
+  constexpr std::size_t Repetitions = 7;
+
+  void RegisterServices(ManagedThreadServiceProvider& rProvider, const std::vector<const std::type_info*>& typeInfos)
+  {
+    std::vector<ServiceInstanceInfo> services;
+    services.reserve(typeInfos.size());
+    for (const std::type_info* const pTypeInfo : typeInfos)
+    {
+      services.push_back({std::make_shared<BenchmarkServiceControl>(), {std::type_index(*pTypeInfo)}});
+    }
+    rProvider.RegisterPriorityGroup(ServiceLaunchPriority(1000), std::move(services));
+  }
+
+  // The lookup reports whether it found a service, checking the total keeps the compiler from dropping the lookups
+  template <typename TLookup>
+  std::chrono::nanoseconds MeasureLookups(const std::vector<const std::type_info*>& typeInfos, TLookup lookup)
+  {
+    auto measureOnce = [&typeInfos, &lookup]
+    {
+      std::size_t foundCount = 0;
+      std::size_t typeIndex = 0;
+      const auto start = BenchmarkClock::now();
+      for (std::size_t i = 0; i < LookupCount; ++i)
+      {
+        foundCount += lookup(*typeInfos[typeIndex]) ? 1u : 0u;
+        typeIndex = typeIndex + 1 < typeInfos.size() ? typeIndex + 1 : 0;
+      }
+      const auto elapsed = BenchmarkClock::now() - start;
+      if (foundCount != LookupCount)
+      {
+        std::printf("error: found %zu of %zu services\n", foundCount, LookupCount);
+      }
+      return elapsed;
+    };
+    return MeasureMedian(Repetitions, measureOnce);
+  }
+
+  double ToNanosecondsPerLookup(const std::chrono::nanoseconds elapsed)
+  {
+    return static_cast<double>(elapsed.count()) / static_cast<double>(LookupCount);
+  }
+}
+
+int main()
+{
+  const std::vector<const std::type_info*> allTypeInfos = GetBenchmarkInterfaceTypeInfos<MaxServiceCount>();
+
+  std::printf("Round-robin lookups over N services with an interface each, ns per lookup, median of %zu runs\n", Repetitions);
+  std::printf("  %5s %14s %14s %14s\n", "N", "TryGetService", "GetService", "TryGetServices");
+  for (const std::size_t serviceCount : {std::size_t{10}, std::size_t{100}, MaxServiceCount})
+  {
+    const std::vector<const std::type_info*> typeInfos(allTypeInfos.begin(), allTypeInfos.begin() + static_cast<std::ptrdiff_t>(serviceCount));
+    ManagedThreadServiceProvider provider;
+    RegisterServices(provider, typeInfos);
+
+    auto tryGetService = [&provider](const std::type_info& type) { return provider.TryGetService(type) != nullptr; };
+    auto getService = [&provider](const std::type_info& type) { return provider.GetService(type) != nullptr; };
+    std::vector<std::shared_ptr<IService>> services;
+    auto tryGetServices = [&provider, &services](const std::type_info& type)
+    {
+      services.clear();
+      return provider.TryGetServices(type, services);
+    };
+
+    std::printf("  %5zu %14.1f %14.1f %14.1f\n", serviceCount, ToNanosecondsPerLookup(MeasureLookups(typeInfos, tryGetService)),
+                ToNanosecondsPerLookup(MeasureLookups(typeInfos, getService)), ToNanosecondsPerLookup(MeasureLookups(typeInfos, tryGetServices)));
+  }
+  return 0;
+}
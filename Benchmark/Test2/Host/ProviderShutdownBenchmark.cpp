@@ -0,0 +1,96 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+// Measures ManagedThreadServiceProvider::UnregisterPriorityGroup when 1000 services are shut down one priority group at a time, in the
+// reverse of the registration order like the hosts do. Build it in Release, the Debug numbers are not meaningful.
+
+#include "../../../src/Test2/Framework/Host/Managed/ManagedThreadServiceProvider.hpp"
+#include "../Util/BenchmarkTimer.hpp"
+#include "ProviderBenchmarkServices.hpp"
+#include <Test2/Framework/Host/ServiceInstanceInfo.hpp>
+#include <Test2/Framework/Registry/ServiceLaunchPriority.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <typeindex>
+#include <vector>
+
+namespace
+{
+  using namespace Test2;
+
+  constexpr std::size_t ServiceCount = 1000;
+  constexpr std::size_t UniqueInterfacesPerService = 4;
+  constexpr std::size_t SharedInterfaceCount = 4;
+  constexpr std::size_t Repetitions = 15;
+
+  // Every service implements four interfaces of its own and the four interfaces that all services share
+  void RegisterServices(ManagedThreadServiceProvider& rProvider, const std::vector<std::type_index>& interfaceTypes, const std::size_t groupSize)
+  {
+    const auto sharedFirst = interfaceTypes.begin() + static_cast<std::ptrdiff_t>(ServiceCount * UniqueInterfacesPerService);
+    std::size_t serviceIndex = 0;
+    for (std::size_t groupIndex = 0; groupIndex < ServiceCount / groupSize; ++groupIndex)
+    {
+      std::vector<ServiceInstanceInfo> services;
+      services.reserve(groupSize);
+      for (std::size_t i = 0; i < groupSize; ++i, ++serviceIndex)
+      {
+        const auto uniqueFirst = interfaceTypes.begin() + static_cast<std::ptrdiff_t>(serviceIndex * UniqueInterfacesPerService);
+        std::vector<std::type_index> supportedInterfaces(uniqueFirst, uniqueFirst + static_cast<std::ptrdiff_t>(UniqueInterfacesPerService));
+        supportedInterfaces.insert(supportedInterfaces.end(), sharedFirst, sharedFirst + static_cast<std::ptrdiff_t>(SharedInterfaceCount));
+        services.push_back({std::make_shared<BenchmarkServiceControl>(), std::move(supportedInterfaces)});
+      }
+      rProvider.RegisterPriorityGroup(ServiceLaunchPriority(static_cast<std::uint32_t>(ServiceCount - groupIndex)), std::move(services));
+    }
+  }
+
+  std::chrono::nanoseconds MeasureShutdown(const std::vector<std::type_index>& interfaceTypes, const std::size_t groupSize)
+  {
+    auto measureOnce = [&interfaceTypes, groupSize]
+    {
+      ManagedThreadServiceProvider provider;
+      RegisterServices(provider, interfaceTypes, groupSize);
+
+      // Unregister the last registered (lowest priority) group first
+      std::size_t removedCount = 0;
+      const auto start = BenchmarkClock::now();
+      for (std::size_t groupIndex = ServiceCount / groupSize; groupIndex > 0; --groupIndex)
+      {
+        removedCount += provider.UnregisterPriorityGroup(ServiceLaunchPriority(static_cast<std::uint32_t>(ServiceCount - groupIndex + 1))).size();
+      }
+      const auto elapsed = BenchmarkClock::now() - start;
+      if (removedCount != ServiceCount)
+      {
+        std::printf("error: removed %zu of %zu services\n", removedCount, ServiceCount);
+      }
+      return elapsed;
+    };
+    return MeasureMedian(Repetitions, measureOnce);
+  }
+}
+
+int main()
+{
+  const std::vector<std::type_index> interfaceTypes = MakeBenchmarkInterfaceTypes<ServiceCount * UniqueInterfacesPerService + SharedInterfaceCount>();
+
+  std::printf("Shutdown of %zu services with %zu interfaces each (%zu shared), median of %zu runs\n", ServiceCount,
+              UniqueInterfacesPerService + SharedInterfaceCount, SharedInterfaceCount, Repetitions);
+  for (const std::size_t groupSize : {std::size_t{1}, std::size_t{10}, std::size_t{100}, ServiceCount})
+  {
+    const std::chrono::duration<double, std::milli> elapsed = MeasureShutdown(interfaceTypes, groupSize);
+    std::printf("  %4zu groups of %4zu: %8.3f ms\n", ServiceCount / groupSize, groupSize, elapsed.count());
+  }
+  return 0;
+}
@@ -0,0 +1,122 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+// Measures CalculatorPlan::Compile throughput on a fixed corpus of long random expressions, 200 operands each with decimal numbers and
+// nested parentheses. Build it in Release, the Debug numbers are not meaningful.
+
+#include "../../Util/BenchmarkTimer.hpp"
+#include <Test2/Services/Calculator/CalculatorPlan.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <exception>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+  using namespace Test2;
+
+  constexpr std::size_t ExpressionCount = 1000;
+  constexpr std::size_t OperandsPerExpression = 200;
+  constexpr std::size_t Repetitions = 7;
+
+  void AppendNumber(std::string& rExpression, std::mt19937& rRandom)
+  {
+    char buffer[32];
+    const bool isNegative = rRandom() % 10 == 0;
+    const int length = std::snprintf(buffer, sizeof(buffer), "%s%u.%03u", isNegative ? "-" : "", static_cast<unsigned>(rRandom() % 10000),
+                                     static_cast<unsigned>(rRandom() % 1000));
+    rExpression.append(buffer, static_cast<std::size_t>(length));
+  }
+
+  // Joins operandCount operands with random operators, now and then a run of them is wrapped in parentheses
+  void AppendExpression(std::string& rExpression, std::mt19937& rRandom, const std::size_t operandCount)
+  {
+    constexpr const char* Operators[] = {" + ", " - ", " * ", " / "};
+    std::size_t operandIndex = 0;
+    while (operandIndex < operandCount)
+    {
+      if (operandIndex > 0)
+      {
+        rExpression += Operators[rRandom() % 4];
+      }
+
+      const std::size_t remaining = operandCount - operandIndex;
+      if (remaining >= 3 && rRandom() % 8 == 0)
+      {
+        const std::size_t groupSize = 2 + rRandom() % std::min<std::size_t>(remaining - 1, 8);
+        rExpression += '(';
+        AppendExpression(rExpression, rRandom, groupSize);
+        rExpression += ')';
+        operandIndex += groupSize;
+      }
+      else
+      {
+        AppendNumber(rExpression, rRandom);
+        ++operandIndex;
+      }
+    }
+  }
+
+  std::vector<std::string> CreateCorpus()
+  {
+    // Fixed seed, every run compiles the same corpus
+    std::mt19937 random(2025);
+    std::vector<std::string> corpus(ExpressionCount);
+    for (std::string& rExpression : corpus)
+    {
+      AppendExpression(rExpression, random, OperandsPerExpression);
+    }
+    return corpus;
+  }
+}
+
+int main()
+{
+  const std::vector<std::string> corpus = CreateCorpus();
+  std::size_t corpusSize = 0;
+  for (const std::string& expression : corpus)
+  {
+    corpusSize += expression.size();
+  }
+
+  std::size_t instructionCount = 0;
+  auto measureOnce = [&corpus, &instructionCount]
+  {
+    instructionCount = 0;
+    const auto start = BenchmarkClock::now();
+    for (const std::string& expression : corpus)
+    {
+      instructionCount += CalculatorPlan::Compile(expression).GetInstructions().size();
+    }
+    return BenchmarkClock::now() - start;
+  };
+
+  try
+  {
+    const std::chrono::duration<double> elapsed = MeasureMedian(Repetitions, measureOnce);
+    std::printf("Compiling %zu expressions with %zu operands each, %zu characters on average, median of %zu runs\n", ExpressionCount,
+                OperandsPerExpression, corpusSize / ExpressionCount, Repetitions);
+    std::printf("  %8.2f MB/s, %8.2f us per expression, %zu instructions\n", static_cast<double>(corpusSize) / elapsed.count() / 1e6,
+                elapsed.count() * 1e6 / static_cast<double>(ExpressionCount), instructionCount);
+  }
+  catch (const std::exception& ex)
+  {
+    std::printf("error: %s\n", ex.what());
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,52 @@
+#ifndef BENCHMARK_BENCHMARKTIMER_HPP
+#define BENCHMARK_BENCHMARKTIMER_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace Test2
+{
+  using BenchmarkClock = std::chrono::steady_clock;
+
+  /// @brief Runs a measurement a number of times and returns the median, so a single preempted run does not skew the result.
+  ///
+  /// The measurement does its own setup and returns only the duration of the part it wants timed.
+  ///
+  /// Usage:
+  ///   const auto median = MeasureMedian(15, []
+  ///   {
+  ///     Setup();
+  ///     const auto start = BenchmarkClock::now();
+  ///     Work();
+  ///     return BenchmarkClock::now() - start;
+  ///   });
+  template <typename TMeasure>
+  std::chrono::nanoseconds MeasureMedian(const std::size_t repetitions, TMeasure measure)
+  {
+    std::vector<std::chrono::nanoseconds> samples;
+    samples.reserve(repetitions);
+    for (std::size_t i = 0; i < repetitions; ++i)
+    {
+      samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(measure()));
+    }
+    const auto middle = samples.begin() + static_cast<std::ptrdiff_t>(samples.size() / 2);
+    std::nth_element(samples.begin(), middle, samples.end());
+    return *middle;
+  }
+}
+
+#endif
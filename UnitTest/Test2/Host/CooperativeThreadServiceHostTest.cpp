@@ -11,13 +11,16 @@
 //* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 //****************************************************************************************************************************************************
 
+#include <Test2/Framework/Exception/WrongThreadException.hpp>
 #include <Test2/Framework/Host/Cooperative/CooperativeThreadServiceHost.hpp>
+#include <Test2/Framework/Host/ServiceProcessTiming.hpp>
 #include <Test2/Framework/Host/StartServiceRecord.hpp>
 #include <Test2/Framework/Registry/ServiceLaunchPriority.hpp>
 #include <Test2/Framework/Service/IServiceControl.hpp>
 #include <Test2/Framework/Service/IServiceFactory.hpp>
 #include <Test2/Framework/Service/ProcessResult.hpp>
 #include <Test2/Framework/Service/ServiceCreateInfo.hpp>
+#include <Test2/Framework/Service/ServiceTickPolicy.hpp>
 #include <boost/asio/co_spawn.hpp>
 #include <boost/asio/detached.hpp>
 #include <boost/asio/post.hpp>
@@ -28,6 +31,7 @@
 #include <span>
 #include <thread>
 #include <typeindex>
+#include <vector>
 
 namespace Test2
 {
@@ -41,6 +45,7 @@ namespace Test2
   {
   private:
     ProcessResult m_processResult;
+    ServiceTickPolicy m_tickPolicy{ServiceTickPolicy::EveryTick()};
     std::atomic<int> m_processCallCount{0};
 
   public:
@@ -65,6 +70,11 @@ namespace Test2
       return m_processResult;
     }
 
+    ServiceTickPolicy GetTickPolicy() const override
+    {
+      return m_tickPolicy;
+    }
+
     int GetProcessCallCount() const noexcept
     {
       return m_processCallCount.load();
@@ -74,6 +84,11 @@ namespace Test2
     {
       m_processResult = result;
     }
+
+    void SetTickPolicy(ServiceTickPolicy policy)
+    {
+      m_tickPolicy = policy;
+    }
   };
 
   struct ITestInterface : public IService
@@ -253,6 +268,58 @@ namespace Test2
     EXPECT_EQ(wakeCount.load(), 1);
   }
 
+  TEST(CooperativeThreadServiceHost, PostWithWake_BurstFromManyThreads_CoalescedIntoOneWake)
+  {
+    constexpr int ProducerCount = 8;
+    constexpr int PostsPerProducer = 1000;
+
+    CooperativeThreadServiceHost host;
+    std::atomic<int> wakeCount{0};
+    int handlerCount = 0;
+
+    host.SetWakeCallback([&wakeCount]() { ++wakeCount; });
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < ProducerCount; ++i)
+    {
+      producers.emplace_back(
+        [&host, &handlerCount]()
+        {
+          for (int j = 0; j < PostsPerProducer; ++j)
+          {
+            host.PostWithWake([&handlerCount]() { ++handlerCount; });
+          }
+        });
+    }
+    for (auto& producer : producers)
+    {
+      producer.join();
+    }
+
+    // The host never polled in between, so one wake covers the whole burst
+    EXPECT_EQ(wakeCount.load(), 1);
+
+    host.Poll();
+    EXPECT_EQ(handlerCount, ProducerCount * PostsPerProducer);
+
+    // Polling re-arms the wake for the next post
+    host.PostWithWake([]() {});
+    EXPECT_EQ(wakeCount.load(), 2);
+  }
+
+  TEST(CooperativeThreadServiceHost, PostWithWake_AfterCallbackCleared_DoesNotInvokeOldCallback)
+  {
+    CooperativeThreadServiceHost host;
+    std::atomic<int> wakeCount{0};
+
+    host.SetWakeCallback([&wakeCount]() { ++wakeCount; });
+    host.SetWakeCallback(nullptr);
+
+    host.PostWithWake([]() {});
+
+    EXPECT_EQ(wakeCount.load(), 0);
+  }
+
   TEST(CooperativeThreadServiceHost, PostWithWake_WithNoCallback_DoesNotThrow)
   {
     CooperativeThreadServiceHost host;
@@ -263,6 +330,178 @@ namespace Test2
     SUCCEED();
   }
 
+  TEST(CooperativeThreadServiceHost, PostWithWake_BeforeCallbackSet_DoesNotSuppressLaterWake)
+  {
+    CooperativeThreadServiceHost host;
+    std::atomic<int> wakeCount{0};
+
+    // Nobody is woken by this post, so it must not leave a pending wake behind
+    host.PostWithWake([]() {});
+
+    host.SetWakeCallback([&wakeCount]() { ++wakeCount; });
+    host.PostWithWake([]() {});
+
+    EXPECT_EQ(wakeCount.load(), 1);
+  }
+
+  TEST(CooperativeThreadServiceHost, SetWakeCallback_RearmsPendingWake)
+  {
+    CooperativeThreadServiceHost host;
+    std::atomic<int> firstWakeCount{0};
+    std::atomic<int> secondWakeCount{0};
+
+    host.SetWakeCallback([&firstWakeCount]() { ++firstWakeCount; });
+    host.PostWithWake([]() {});
+    EXPECT_EQ(firstWakeCount.load(), 1);
+
+    // The first wake is still pending as the host never polled, the new callback is woken anyway
+    host.SetWakeCallback([&secondWakeCount]() { ++secondWakeCount; });
+    host.PostWithWake([]() {});
+
+    EXPECT_EQ(firstWakeCount.load(), 1);
+    EXPECT_EQ(secondWakeCount.load(), 1);
+  }
+
+  TEST(CooperativeThreadServiceHost, SetWakeCallback_WaitsForRunningCallback)
+  {
+    CooperativeThreadServiceHost host;
+    std::atomic<bool> callbackEntered{false};
+    std::atomic<bool> releaseCallback{false};
+    std::atomic<bool> callbackReturned{false};
+
+    host.SetWakeCallback(
+      [&]()
+      {
+        callbackEntered = true;
+        while (!releaseCallback.load())
+        {
+          std::this_thread::yield();
+        }
+        callbackReturned = true;
+      });
+
+    std::thread worker([&host]() { host.PostWithWake([]() {}); });
+    while (!callbackEntered.load())
+    {
+      std::this_thread::yield();
+    }
+
+    std::thread releaser(
+      [&releaseCallback]()
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        releaseCallback = true;
+      });
+
+    // Replacing the callback must not destroy it while the worker is still inside it
+    host.SetWakeCallback(nullptr);
+    EXPECT_TRUE(callbackReturned.load());
+
+    worker.join();
+    releaser.join();
+  }
+
+  // ============================================================================
+  // WaitForWork Tests
+  // ============================================================================
+
+  TEST(CooperativeThreadServiceHost, WaitForWork_SleepLimit_ReturnsAfterDuration)
+  {
+    CooperativeThreadServiceHost host;
+
+    auto start = std::chrono::steady_clock::now();
+    auto handlerCount = host.WaitForWork(ProcessResult::SleepLimit(20ms));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(handlerCount, 0u);
+    EXPECT_GE(elapsed, 20ms);
+    EXPECT_LT(elapsed, 1s);
+  }
+
+  TEST(CooperativeThreadServiceHost, WaitForWork_Quit_ReturnsImmediately)
+  {
+    CooperativeThreadServiceHost host;
+
+    auto start = std::chrono::steady_clock::now();
+    host.WaitForWork(ProcessResult::Quit());
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_LT(elapsed, 10ms);
+  }
+
+  TEST(CooperativeThreadServiceHost, WaitForWork_PostFromAnotherThread_WakesBeforeSleepLimit)
+  {
+    CooperativeThreadServiceHost host;
+    std::atomic<bool> handlerExecuted{false};
+
+    std::thread worker(
+      [&host, &handlerExecuted]()
+      {
+        std::this_thread::sleep_for(10ms);
+        // A plain post without the wake callback is enough to wake the waiting thread
+        boost::asio::post(host.GetExecutor(), [&handlerExecuted]() { handlerExecuted = true; });
+      });
+
+    auto start = std::chrono::steady_clock::now();
+    auto handlerCount = host.WaitForWork(ProcessResult::SleepLimit(5s));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    worker.join();
+
+    EXPECT_EQ(handlerCount, 1u);
+    EXPECT_TRUE(handlerExecuted.load());
+    EXPECT_LT(elapsed, 1s);
+  }
+
+  TEST(CooperativeThreadServiceHost, WaitForWork_NoSleepLimit_WakesOnPost)
+  {
+    CooperativeThreadServiceHost host;
+    std::atomic<bool> handlerExecuted{false};
+
+    std::thread worker(
+      [&host, &handlerExecuted]()
+      {
+        std::this_thread::sleep_for(10ms);
+        boost::asio::post(host.GetExecutor(), [&handlerExecuted]() { handlerExecuted = true; });
+      });
+
+    auto handlerCount = host.WaitForWork(ProcessResult::NoSleepLimit());
+    worker.join();
+
+    EXPECT_EQ(handlerCount, 1u);
+    EXPECT_TRUE(handlerExecuted.load());
+  }
+
+  TEST(CooperativeThreadServiceHost, WaitForWork_RequestStop_ReleasesWait)
+  {
+    CooperativeThreadServiceHost host;
+
+    std::thread worker(
+      [&host]()
+      {
+        std::this_thread::sleep_for(10ms);
+        host.RequestStop();
+      });
+
+    auto handlerCount = host.WaitForWork(ProcessResult::NoSleepLimit());
+    worker.join();
+
+    EXPECT_EQ(handlerCount, 0u);
+    // Once stopped the host does not wait anymore
+    EXPECT_EQ(host.WaitForWork(ProcessResult::NoSleepLimit()), 0u);
+  }
+
+  TEST(CooperativeThreadServiceHost, WaitForWork_AfterPollRanOutOfWork_StillWaits)
+  {
+    CooperativeThreadServiceHost host;
+    host.Poll();
+
+    auto start = std::chrono::steady_clock::now();
+    host.WaitForWork(ProcessResult::SleepLimit(20ms));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_GE(elapsed, 20ms);
+  }
+
   // ============================================================================
   // ProcessServices Tests
   // ============================================================================
@@ -376,4 +615,126 @@ namespace Test2
 
     EXPECT_EQ(service1->GetProcessCallCount(), 3);
   }
+
+  TEST_F(CooperativeThreadServiceHostServiceTest, NeverTickPolicy_ProcessIsNotCalled)
+  {
+    service1->SetTickPolicy(ServiceTickPolicy::Never());
+    RegisterService(service1, "Service1", 1000);
+    RegisterService(service2, "Service2", 500);
+
+    host.Update();
+    host.Update();
+
+    EXPECT_EQ(service1->GetProcessCallCount(), 0);
+    EXPECT_EQ(service2->GetProcessCallCount(), 2);
+  }
+
+  TEST_F(CooperativeThreadServiceHostServiceTest, PeriodicTickPolicy_LimitsSleep)
+  {
+    service1->SetTickPolicy(ServiceTickPolicy::Periodic(1h));
+    RegisterService(service1, "TestService", 1000);
+
+    auto result = host.ProcessServices();
+    EXPECT_EQ(service1->GetProcessCallCount(), 1);
+    EXPECT_EQ(result.Status, ProcessStatus::SleepLimit);
+    EXPECT_LE(result.Duration, 1h);
+    EXPECT_GT(result.Duration, 59min);
+
+    // Not due again for an hour
+    host.ProcessServices();
+    EXPECT_EQ(service1->GetProcessCallCount(), 1);
+  }
+
+  // ============================================================================
+  // Process Timing Tests
+  // ============================================================================
+
+  TEST_F(CooperativeThreadServiceHostServiceTest, ProcessTiming_DisabledByDefault)
+  {
+    RegisterService(service1, "TestService", 1000);
+
+    host.Update();
+
+    EXPECT_FALSE(host.IsProcessTimingEnabled());
+    EXPECT_TRUE(host.GetProcessTimings().empty());
+  }
+
+  TEST_F(CooperativeThreadServiceHostServiceTest, ProcessTiming_Enabled_CountsEveryProcessCall)
+  {
+    RegisterService(service1, "Service1", 1000);
+    RegisterService(service2, "Service2", 500);
+    // Ticks before timing was enabled are not counted
+    host.Update();
+
+    host.SetProcessTimingEnabled(true);
+    host.Update();
+    host.Update();
+    host.Update();
+
+    const std::vector<ServiceProcessTiming> timings = host.GetProcessTimings();
+    ASSERT_EQ(timings.size(), 2u);
+    for (const ServiceProcessTiming& timing : timings)
+    {
+      EXPECT_EQ(timing.ServiceType, std::type_index(typeid(MockCooperativeService)));
+      EXPECT_EQ(timing.CallCount, 3u);
+      EXPECT_LE(timing.P50, timing.P99);
+      EXPECT_LE(timing.P99, timing.Max);
+    }
+  }
+
+  TEST_F(CooperativeThreadServiceHostServiceTest, ProcessTiming_KeptWhenServicesAreAdded)
+  {
+    host.SetProcessTimingEnabled(true);
+    RegisterService(service1, "Service1", 1000);
+    host.Update();
+    host.Update();
+
+    RegisterService(service2, "Service2", 500);
+    host.Update();
+
+    const std::vector<ServiceProcessTiming> timings = host.GetProcessTimings();
+    ASSERT_EQ(timings.size(), 2u);
+    EXPECT_EQ(timings[0].CallCount, 3u);
+    EXPECT_EQ(timings[1].CallCount, 1u);
+  }
+
+  TEST_F(CooperativeThreadServiceHostServiceTest, ProcessTiming_ResetAndDisable)
+  {
+    RegisterService(service1, "TestService", 1000);
+    host.SetProcessTimingEnabled(true);
+    host.Update();
+    host.Update();
+
+    host.ResetProcessTimings();
+    host.Update();
+    std::vector<ServiceProcessTiming> timings = host.GetProcessTimings();
+    ASSERT_EQ(timings.size(), 1u);
+    EXPECT_EQ(timings[0].CallCount, 1u);
+
+    host.SetProcessTimingEnabled(false);
+    EXPECT_TRUE(host.GetProcessTimings().empty());
+    host.Update();
+    EXPECT_TRUE(host.GetProcessTimings().empty());
+    EXPECT_EQ(service1->GetProcessCallCount(), 4);
+  }
+
+  TEST(CooperativeThreadServiceHost, GetProcessTimings_FromWrongThread_Throws)
+  {
+    CooperativeThreadServiceHost host;
+    bool threw = false;
+    std::thread other(
+      [&host, &threw]()
+      {
+        try
+        {
+          (void)host.GetProcessTimings();
+        }
+        catch (const WrongThreadException&)
+        {
+          threw = true;
+        }
+      });
+    other.join();
+    EXPECT_TRUE(threw);
+  }
 }
@@ -18,6 +18,7 @@
 #include <Test2/Framework/Host/Managed/ManagedThreadHost.hpp>
 #include <Test2/Framework/Host/Managed/ManagedThreadServiceHost.hpp>
 #include <Test2/Framework/Host/Managed/ManagedThreadServiceProvider.hpp>
+#include <Test2/Framework/Host/ServiceProcessTiming.hpp>
 #include <Test2/Framework/Host/StartServiceRecord.hpp>
 #include <Test2/Framework/Registry/ServiceLaunchPriority.hpp>
 #include <Test2/Framework/Service/IServiceFactory.hpp>
@@ -28,10 +29,12 @@
 #include <boost/asio/use_future.hpp>
 #include <gtest/gtest.h>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <thread>
 #include <typeindex>
+#include <vector>
 #include "TestManagedThreadLifecycle.hpp"
 
 namespace Test2
@@ -339,6 +342,76 @@ namespace Test2
     EXPECT_TRUE(true);    // If we got here without hanging, the test passes
   }
 
+  TEST_F(ManagedThreadHostTestFixtureBase, StartAllAsync_MultipleHosts_AllStartedAndShutDown)
+  {
+    ManagedThreadHost host1(m_testHost.GetExecutorContext());
+    ManagedThreadHost host2(m_testHost.GetExecutorContext());
+    ManagedThreadHost* hosts[] = {&host1, &host2};
+
+    std::size_t recordCount = 0;
+    RunTest(
+      [&hosts, &recordCount]() -> boost::asio::awaitable<void>
+      {
+        auto records = co_await ManagedThreadHost::StartAllAsync(hosts);
+        recordCount = records.size();
+      });
+
+    EXPECT_EQ(recordCount, 2u);
+    EXPECT_NE(host1.GetServiceHost(), nullptr);
+    EXPECT_NE(host2.GetServiceHost(), nullptr);
+
+    bool host1Shutdown = false;
+    bool host2Shutdown = false;
+    RunTest(
+      [&]() -> boost::asio::awaitable<void>
+      {
+        host1Shutdown = co_await host1.TryShutdownAsync();
+        host2Shutdown = co_await host2.TryShutdownAsync();
+      });
+
+    EXPECT_TRUE(host1Shutdown);
+    EXPECT_TRUE(host2Shutdown);
+  }
+
+  TEST_F(ManagedThreadHostTestFixtureBase, Lifetime_AwaitedOnCooperativeHost_DoesNotBlockUntilThreadExits)
+  {
+    ManagedThreadHost host(m_testHost.GetExecutorContext());
+    std::optional<ManagedThreadRecord> record;
+    RunTest([&host, &record]() -> boost::asio::awaitable<void> { record.emplace(co_await host.StartAsync()); });
+
+    bool lifetimeEnded = false;
+    boost::asio::co_spawn(
+      m_testHost.GetExecutorContext().GetExecutor(),
+      [&record, &lifetimeEnded]() -> boost::asio::awaitable<void>
+      {
+        co_await std::move(record->Lifetime);
+        lifetimeEnded = true;
+      },
+      boost::asio::detached);
+
+    // The waiter is suspended, so polling returns while the managed thread is still running
+    m_testHost.Poll();
+    EXPECT_FALSE(lifetimeEnded);
+
+    bool shutdownResult = false;
+    RunTest([&host, &shutdownResult]() -> boost::asio::awaitable<void> { shutdownResult = co_await host.TryShutdownAsync(); });
+    EXPECT_TRUE(shutdownResult);
+
+    while (!lifetimeEnded)
+    {
+      m_testHost.Poll();
+    }
+    EXPECT_TRUE(lifetimeEnded);
+  }
+
+  TEST_F(ManagedThreadHostTestFixtureBase, StartAllAsync_HostAlreadyStarted_Throws)
+  {
+    StartHost();
+
+    ManagedThreadHost* hosts[] = {&m_host};
+    EXPECT_THROW(RunTest([&hosts]() -> boost::asio::awaitable<void> { co_await ManagedThreadHost::StartAllAsync(hosts); }), std::runtime_error);
+  }
+
   // ========================================
   // AUTOMATIC LIFECYCLE TESTS - Use helper methods with automatic service tracking
   // ========================================
@@ -493,4 +566,47 @@ namespace Test2
 
     EXPECT_FALSE(trackers[0]->shutdownCalled);    // Should not be called
   }
+
+  // ========================================
+  // Process Timing
+  // ========================================
+
+  TEST_F(ManagedThreadHostTestFixtureBase, GetProcessTimingsAsync_BeforeStart_Throws)
+  {
+    EXPECT_THROW(RunTest([this]() -> boost::asio::awaitable<void> { co_await m_host.GetProcessTimingsAsync(); }), std::runtime_error);
+  }
+
+  TEST_F(ManagedThreadHostTestFixtureBase, ProcessTiming_ProcessTickMode_RecordsOnManagedThread)
+  {
+    ManagedThreadHost host(m_testHost.GetExecutorContext(), ManagedThreadRunMode::ProcessTick);
+    std::vector<StartServiceRecord> services;
+    services.emplace_back("TimedService", CreateMockFactory("TimedService"));
+    RunTest(
+      [&host, &services]() -> boost::asio::awaitable<void>
+      {
+        co_await host.StartAsync();
+        co_await host.SetProcessTimingEnabledAsync(true);
+        co_await host.GetServiceHost()->TryStartServicesAsync(std::move(services), ServiceLaunchPriority(1000));
+      });
+
+    // The service never asks for a sleep limit, so every handler the query posts is followed by one tick
+    std::vector<ServiceProcessTiming> timings;
+    for (int attempt = 0; attempt < 100 && (timings.empty() || timings[0].CallCount < 2); ++attempt)
+    {
+      RunTest([&host, &timings]() -> boost::asio::awaitable<void> { timings = co_await host.GetProcessTimingsAsync(); });
+    }
+    ASSERT_EQ(timings.size(), 1u);
+    EXPECT_EQ(timings[0].ServiceType, std::type_index(typeid(MockService)));
+    EXPECT_GE(timings[0].CallCount, 2u);
+    EXPECT_LE(timings[0].P99, timings[0].Max);
+
+    bool shutdownResult = false;
+    RunTest(
+      [&host, &shutdownResult]() -> boost::asio::awaitable<void>
+      {
+        co_await host.GetServiceHost()->TryShutdownServicesAsync(ServiceLaunchPriority(1000));
+        shutdownResult = co_await host.TryShutdownAsync();
+      });
+    EXPECT_TRUE(shutdownResult);
+  }
 }
@@ -21,10 +21,13 @@
 #include <Test2/Framework/Service/IServiceControl.hpp>
 #include <Test2/Framework/Service/ProcessResult.hpp>
 #include <Test2/Framework/Service/ServiceCreateInfo.hpp>
+#include <Test2/Framework/Service/ServiceIdBinding.hpp>
 #include <Test2/Framework/Service/ServiceInitResult.hpp>
 #include <Test2/Framework/Service/ServiceShutdownResult.hpp>
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <span>
 #include <typeindex>
@@ -76,6 +79,40 @@ namespace Test2
   {
   };
 
+  // Interfaces that declare a compile-time ServiceId, the second one reuses the id of the first
+  struct ITestIdInterface : public IService
+  {
+    static constexpr ServiceId Id{2};
+
+    virtual int GetValue() const = 0;
+  };
+  struct ITestConflictingIdInterface : public IService
+  {
+    static constexpr ServiceId Id{2};
+  };
+
+  // Implements ITestIdInterface next to IServiceControl, so it has two IService bases like the real services
+  class MockIdServiceControl
+    : public MockServiceControl
+    , public ITestIdInterface
+  {
+  public:
+    explicit MockIdServiceControl(int id)
+      : MockServiceControl(id)
+    {
+    }
+
+    int GetValue() const override
+    {
+      return GetId();
+    }
+  };
+
+  Test2::ServiceInstanceInfo CreateIdServiceInfo(std::shared_ptr<IServiceControl> service)
+  {
+    return {std::move(service), {std::type_index(typeid(ITestIdInterface))}, {MakeServiceIdBinding<ITestIdInterface>()}};
+  }
+
   // Create helper function for service instance info vectors with default interfaces
   std::vector<Test2::ServiceInstanceInfo> CreateServices(const std::vector<int>& ids)
   {
@@ -996,6 +1033,125 @@ TEST(ManagedThreadServiceProviderTest, TryGetServicesAcrossPriorityGroups)
   ASSERT_EQ(services.size(), 2);
 }
 
+// Tests: TryGetServices returns matching services in registration order
+// Verifies: Services come back ordered by priority group (highest first) and then by their position inside the group
+TEST(ManagedThreadServiceProviderTest, TryGetServicesPreservesRegistrationOrder)
+{
+  ManagedThreadServiceProvider provider;
+
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), {{std::make_shared<MockServiceControl>(3), {std::type_index(typeid(ITestInterface1))}},
+                                                               {std::make_shared<MockServiceControl>(1), {std::type_index(typeid(ITestInterface2))}},
+                                                               {std::make_shared<MockServiceControl>(2), {std::type_index(typeid(ITestInterface1))}}});
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(500), {{std::make_shared<MockServiceControl>(0), {std::type_index(typeid(ITestInterface1))}}});
+
+  std::vector<std::shared_ptr<IService>> services;
+  ASSERT_TRUE(provider.TryGetServices(typeid(ITestInterface1), services));
+  ASSERT_EQ(services.size(), 3u);
+  EXPECT_EQ(std::dynamic_pointer_cast<MockServiceControl>(services[0])->GetId(), 3);
+  EXPECT_EQ(std::dynamic_pointer_cast<MockServiceControl>(services[1])->GetId(), 2);
+  EXPECT_EQ(std::dynamic_pointer_cast<MockServiceControl>(services[2])->GetId(), 0);
+
+  // TryGetService picks the first one in the same order
+  auto first = std::dynamic_pointer_cast<MockServiceControl>(provider.TryGetService(typeid(ITestInterface1)));
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first->GetId(), 3);
+}
+
+// Tests: Lookups reflect the remaining groups after an unregister
+// Verifies: Unregistering the high priority group leaves the low priority service as the only match for a shared interface
+TEST(ManagedThreadServiceProviderTest, LookupAfterUnregisterFindsRemainingServices)
+{
+  ManagedThreadServiceProvider provider;
+
+  auto service1 = std::make_shared<MockServiceControl>(1);
+  auto service2 = std::make_shared<MockServiceControl>(2);
+
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(1000),
+                                 {{service1, {std::type_index(typeid(ITestInterface1)), std::type_index(typeid(ITestInterface2))}}});
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(500), {{service2, {std::type_index(typeid(ITestInterface1))}}});
+  EXPECT_THROW(provider.GetService(typeid(ITestInterface1)), MultipleServicesFoundException);
+
+  auto removed = provider.UnregisterPriorityGroup(ServiceLaunchPriority(1000));
+  EXPECT_EQ(removed.size(), 1u);
+
+  EXPECT_EQ(provider.GetService(typeid(ITestInterface1)), service2);
+  EXPECT_EQ(provider.TryGetService(typeid(ITestInterface2)), nullptr);
+}
+
+// Tests: Unregistering a group from the middle keeps the order of the remaining services
+// Verifies: Lookups and the process list still follow registration order, and the interface can be registered again afterwards
+TEST(ManagedThreadServiceProviderTest, UnregisterMiddleGroupKeepsRegistrationOrder)
+{
+  ManagedThreadServiceProvider provider;
+
+  RegisterWithDefaults(provider, ServiceLaunchPriority(1000), {1, 2});
+  RegisterWithDefaults(provider, ServiceLaunchPriority(500), {3, 4});
+  RegisterWithDefaults(provider, ServiceLaunchPriority(100), {5});
+
+  auto removed = provider.UnregisterPriorityGroup(ServiceLaunchPriority(500));
+  EXPECT_EQ(ExtractServiceIds(removed), (std::vector<int>{3, 4}));
+
+  std::vector<std::shared_ptr<IService>> services;
+  ASSERT_TRUE(provider.TryGetServices(typeid(ITestInterface1), services));
+  std::vector<int> lookupIds;
+  for (const auto& service : services)
+  {
+    lookupIds.push_back(std::dynamic_pointer_cast<MockServiceControl>(service)->GetId());
+  }
+  EXPECT_EQ(lookupIds, (std::vector<int>{1, 2, 5}));
+
+  std::vector<int> processIds;
+  for (IServiceControl* pService : provider.GetProcessList())
+  {
+    processIds.push_back(dynamic_cast<MockServiceControl*>(pService)->GetId());
+  }
+  EXPECT_EQ(processIds, (std::vector<int>{1, 2, 5}));
+
+  removed = provider.UnregisterPriorityGroup(ServiceLaunchPriority(100));
+  removed = provider.UnregisterPriorityGroup(ServiceLaunchPriority(1000));
+  EXPECT_EQ(provider.TryGetService(typeid(ITestInterface1)), nullptr);
+
+  RegisterWithDefaults(provider, ServiceLaunchPriority(50), {6});
+  EXPECT_EQ(std::dynamic_pointer_cast<MockServiceControl>(provider.GetService(typeid(ITestInterface1)))->GetId(), 6);
+}
+
+// Tests: Shutting down many priority groups in reverse registration order, the way the host does
+// Verifies: Every group returns its own service and the provider ends up empty
+TEST(ManagedThreadServiceProviderTest, UnregisterThousandGroupsInReverseOrder)
+{
+  ManagedThreadServiceProvider provider;
+  constexpr int ServiceCount = 1000;
+
+  for (int i = 0; i < ServiceCount; ++i)
+  {
+    RegisterWithDefaults(provider, ServiceLaunchPriority(static_cast<uint32_t>(ServiceCount - i)), {i});
+  }
+  EXPECT_EQ(provider.GetServiceCount(), static_cast<std::size_t>(ServiceCount));
+
+  for (int i = ServiceCount - 1; i >= 0; --i)
+  {
+    auto removed = provider.UnregisterPriorityGroup(ServiceLaunchPriority(static_cast<uint32_t>(ServiceCount - i)));
+    ASSERT_EQ(ExtractServiceIds(removed), (std::vector<int>{i}));
+  }
+  EXPECT_EQ(provider.GetServiceCount(), 0u);
+  EXPECT_TRUE(provider.GetProcessList().empty());
+  EXPECT_EQ(provider.TryGetService(typeid(ITestInterface1)), nullptr);
+}
+
+// Tests: A rejected registration leaves the type index untouched
+// Verifies: When a later service in the group is invalid, the valid services before it are not made visible to lookups
+TEST(ManagedThreadServiceProviderTest, FailedRegistrationDoesNotModifyTypeIndex)
+{
+  ManagedThreadServiceProvider provider;
+
+  std::vector<Test2::ServiceInstanceInfo> serviceInfos;
+  serviceInfos.push_back({std::make_shared<MockServiceControl>(1), {std::type_index(typeid(ITestInterface1))}});
+  serviceInfos.push_back({std::make_shared<MockServiceControl>(2), {}});
+
+  EXPECT_THROW(provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), std::move(serviceInfos)), std::invalid_argument);
+  EXPECT_EQ(provider.TryGetService(typeid(ITestInterface1)), nullptr);
+}
+
 // Tests: TryGetServices safely handles empty provider state
 // Verifies: Returns false and leaves vector empty when no services are registered
 TEST(ManagedThreadServiceProviderTest, TryGetServicesReturnsFalseOnEmptyProvider)
@@ -1265,6 +1421,252 @@ TEST(ManagedThreadServiceProviderTest, ServiceLookupPreservesServiceLifetime)
   EXPECT_TRUE(weakService.expired());
 }
 
+// ========================================
+// ServiceId Tests
+// ========================================
+
+// Tests: TryGetUniqueService returns the bound service already adjusted to the interface
+// Verifies: The pointer refers to the ITestIdInterface subobject, so a static_pointer_cast yields the same object as a dynamic cast
+TEST(ManagedThreadServiceProviderTest, TryGetUniqueService_ReturnsServiceCastToInterface)
+{
+  ManagedThreadServiceProvider provider;
+  auto service = std::make_shared<MockIdServiceControl>(5);
+
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateIdServiceInfo(service)});
+
+  auto bound = provider.TryGetUniqueService(ITestIdInterface::Id, typeid(ITestIdInterface));
+  ASSERT_NE(bound, nullptr);
+  auto typed = std::static_pointer_cast<ITestIdInterface>(bound);
+  EXPECT_EQ(typed.get(), static_cast<ITestIdInterface*>(service.get()));
+  EXPECT_EQ(typed->GetValue(), 5);
+}
+
+// Tests: TryGetUniqueService only answers for the id and type that were bound
+// Verifies: Unknown ids, a different type for the same id and an empty provider all return nullptr
+TEST(ManagedThreadServiceProviderTest, TryGetUniqueService_ReturnsNullForUnboundIdOrType)
+{
+  ManagedThreadServiceProvider provider;
+  EXPECT_EQ(provider.TryGetUniqueService(ITestIdInterface::Id, typeid(ITestIdInterface)), nullptr);
+
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateIdServiceInfo(std::make_shared<MockIdServiceControl>(5))});
+
+  EXPECT_EQ(provider.TryGetUniqueService(ServiceId(0), typeid(ITestIdInterface)), nullptr);
+  EXPECT_EQ(provider.TryGetUniqueService(ServiceId(100), typeid(ITestIdInterface)), nullptr);
+  EXPECT_EQ(provider.TryGetUniqueService(ITestIdInterface::Id, typeid(ITestConflictingIdInterface)), nullptr);
+}
+
+// Tests: TryGetUniqueService has no fast path when several services support the bound type
+// Verifies: Returns nullptr so GetService<T> falls back to the type lookup, which reports the ambiguity
+TEST(ManagedThreadServiceProviderTest, TryGetUniqueService_ReturnsNullWhenMultipleServicesSupportType)
+{
+  ManagedThreadServiceProvider provider;
+
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateIdServiceInfo(std::make_shared<MockIdServiceControl>(1))});
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(500), {CreateIdServiceInfo(std::make_shared<MockIdServiceControl>(2))});
+
+  EXPECT_EQ(provider.TryGetUniqueService(ITestIdInterface::Id, typeid(ITestIdInterface)), nullptr);
+  EXPECT_THROW(provider.GetService(typeid(ITestIdInterface)), MultipleServicesFoundException);
+
+  // Once the other service is gone the id is unique again
+  auto removed = provider.UnregisterPriorityGroup(ServiceLaunchPriority(500));
+  EXPECT_EQ(removed.size(), 1u);
+  auto bound = provider.TryGetUniqueService(ITestIdInterface::Id, typeid(ITestIdInterface));
+  ASSERT_NE(bound, nullptr);
+  EXPECT_EQ(std::static_pointer_cast<ITestIdInterface>(bound)->GetValue(), 1);
+}
+
+// Tests: Unregistering a priority group clears its ServiceId slots
+TEST(ManagedThreadServiceProviderTest, TryGetUniqueService_ReturnsNullAfterUnregister)
+{
+  ManagedThreadServiceProvider provider;
+
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateIdServiceInfo(std::make_shared<MockIdServiceControl>(1))});
+  auto removed = provider.UnregisterPriorityGroup(ServiceLaunchPriority(1000));
+  EXPECT_EQ(removed.size(), 1u);
+
+  EXPECT_EQ(provider.TryGetUniqueService(ITestIdInterface::Id, typeid(ITestIdInterface)), nullptr);
+}
+
+// Tests: The fast path follows services that support the bound type without declaring the binding
+// Verifies: Removing the other service makes the id unique again, removing the only service that declared the binding releases the slot
+TEST(ManagedThreadServiceProviderTest, TryGetUniqueService_TracksServicesWithoutBinding)
+{
+  ManagedThreadServiceProvider provider;
+  auto bindingService = std::make_shared<MockIdServiceControl>(1);
+  auto plainService = std::make_shared<MockIdServiceControl>(2);
+
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateIdServiceInfo(bindingService)});
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(500), {{plainService, {std::type_index(typeid(ITestIdInterface))}}});
+  EXPECT_EQ(provider.TryGetUniqueService(ITestIdInterface::Id, typeid(ITestIdInterface)), nullptr);
+
+  auto removed = provider.UnregisterPriorityGroup(ServiceLaunchPriority(500));
+  EXPECT_EQ(removed.size(), 1u);
+  auto bound = provider.TryGetUniqueService(ITestIdInterface::Id, typeid(ITestIdInterface));
+  ASSERT_NE(bound, nullptr);
+  EXPECT_EQ(std::static_pointer_cast<ITestIdInterface>(bound)->GetValue(), 1);
+
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(100), {{plainService, {std::type_index(typeid(ITestIdInterface))}}});
+  removed = provider.UnregisterPriorityGroup(ServiceLaunchPriority(1000));
+  EXPECT_EQ(removed.size(), 1u);
+  EXPECT_EQ(provider.TryGetUniqueService(ITestIdInterface::Id, typeid(ITestIdInterface)), nullptr);
+  EXPECT_EQ(std::dynamic_pointer_cast<MockServiceControl>(provider.GetService(typeid(ITestIdInterface)))->GetId(), 2);
+}
+
+// Tests: An interface can only be bound to a single ServiceId
+TEST(ManagedThreadServiceProviderTest, ServiceIdBindingToSecondIdThrows)
+{
+  ManagedThreadServiceProvider provider;
+  ServiceIdBinding otherId = MakeServiceIdBinding<ITestIdInterface>();
+  otherId.Id = ServiceId(7);
+
+  std::vector<Test2::ServiceInstanceInfo> sameGroup;
+  sameGroup.push_back(CreateIdServiceInfo(std::make_shared<MockIdServiceControl>(1)));
+  sameGroup.push_back({std::make_shared<MockIdServiceControl>(2), {std::type_index(typeid(ITestIdInterface))}, {otherId}});
+  EXPECT_THROW(provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), std::move(sameGroup)), std::invalid_argument);
+
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateIdServiceInfo(std::make_shared<MockIdServiceControl>(1))});
+  std::vector<Test2::ServiceInstanceInfo> laterGroup;
+  laterGroup.push_back({std::make_shared<MockIdServiceControl>(2), {std::type_index(typeid(ITestIdInterface))}, {otherId}});
+  EXPECT_THROW(provider.RegisterPriorityGroup(ServiceLaunchPriority(500), std::move(laterGroup)), std::invalid_argument);
+  EXPECT_EQ(provider.TryGetUniqueService(ServiceId(7), typeid(ITestIdInterface)), nullptr);
+}
+
+// Tests: Ids above ServiceId::MaxValue are rejected instead of growing the slot table
+TEST(ManagedThreadServiceProviderTest, ServiceIdAboveMaxValueThrows)
+{
+  ManagedThreadServiceProvider provider;
+  for (const std::uint32_t id : {ServiceId::MaxValue + 1u, std::uint32_t{4000000000u}, std::numeric_limits<std::uint32_t>::max()})
+  {
+    ServiceIdBinding tooLarge = MakeServiceIdBinding<ITestIdInterface>();
+    tooLarge.Id = ServiceId(id);
+
+    std::vector<Test2::ServiceInstanceInfo> serviceInfos;
+    serviceInfos.push_back({std::make_shared<MockIdServiceControl>(1), {std::type_index(typeid(ITestIdInterface))}, {tooLarge}});
+    EXPECT_THROW(provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), std::move(serviceInfos)), std::invalid_argument);
+    EXPECT_EQ(provider.TryGetUniqueService(ServiceId(id), typeid(ITestIdInterface)), nullptr);
+  }
+  EXPECT_EQ(provider.GetServiceCount(), 0u);
+
+  // The largest accepted id still works
+  ServiceIdBinding largest = MakeServiceIdBinding<ITestIdInterface>();
+  largest.Id = ServiceId(ServiceId::MaxValue);
+  auto service = std::make_shared<MockIdServiceControl>(1);
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), {{service, {std::type_index(typeid(ITestIdInterface))}, {largest}}});
+  EXPECT_NE(provider.TryGetUniqueService(ServiceId(ServiceId::MaxValue), typeid(ITestIdInterface)), nullptr);
+}
+
+// Tests: A binding for an interface the service does not list in SupportedInterfaces is rejected
+TEST(ManagedThreadServiceProviderTest, ServiceIdBindingForUnsupportedInterfaceThrows)
+{
+  ManagedThreadServiceProvider provider;
+
+  std::vector<Test2::ServiceInstanceInfo> serviceInfos;
+  serviceInfos.push_back(
+    {std::make_shared<MockIdServiceControl>(1), {std::type_index(typeid(ITestInterface1))}, {MakeServiceIdBinding<ITestIdInterface>()}});
+
+  EXPECT_THROW(provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), std::move(serviceInfos)), std::invalid_argument);
+  EXPECT_EQ(provider.GetServiceCount(), 0u);
+}
+
+// Tests: A binding for an interface the service does not implement is rejected at registration
+// Verifies: This is the check that lets lookups by id use a static_pointer_cast
+TEST(ManagedThreadServiceProviderTest, ServiceIdBindingForUnimplementedInterfaceThrows)
+{
+  ManagedThreadServiceProvider provider;
+
+  std::vector<Test2::ServiceInstanceInfo> serviceInfos;
+  serviceInfos.push_back(CreateIdServiceInfo(std::make_shared<MockServiceControl>(1)));
+
+  EXPECT_THROW(provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), std::move(serviceInfos)), std::invalid_argument);
+  EXPECT_EQ(provider.TryGetService(typeid(ITestIdInterface)), nullptr);
+}
+
+// Tests: Two interfaces can not share a ServiceId
+// Verifies: Conflicts are detected against earlier groups and within the group being registered
+TEST(ManagedThreadServiceProviderTest, ConflictingServiceIdThrows)
+{
+  ManagedThreadServiceProvider provider;
+
+  struct ConflictingService
+    : public MockServiceControl
+    , public ITestConflictingIdInterface
+  {
+    ConflictingService()
+      : MockServiceControl(2)
+    {
+    }
+  };
+  auto createConflicting = []()
+  {
+    return Test2::ServiceInstanceInfo{std::make_shared<ConflictingService>(),
+                                      {std::type_index(typeid(ITestConflictingIdInterface))},
+                                      {MakeServiceIdBinding<ITestConflictingIdInterface>()}};
+  };
+
+  std::vector<Test2::ServiceInstanceInfo> sameGroup;
+  sameGroup.push_back(CreateIdServiceInfo(std::make_shared<MockIdServiceControl>(1)));
+  sameGroup.push_back(createConflicting());
+  EXPECT_THROW(provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), std::move(sameGroup)), std::invalid_argument);
+
+  provider.RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateIdServiceInfo(std::make_shared<MockIdServiceControl>(1))});
+  EXPECT_THROW(provider.RegisterPriorityGroup(ServiceLaunchPriority(500), {createConflicting()}), std::invalid_argument);
+  EXPECT_NE(provider.TryGetUniqueService(ITestIdInterface::Id, typeid(ITestIdInterface)), nullptr);
+}
+
+// Tests: The generation counter changes exactly when the registered services change
+// Verifies: Register and unregister bump it, unregistering an unknown priority does not, destruction marks it expired
+TEST(ManagedThreadServiceProviderTest, GetGeneration_ChangesWhenRegistrationsChange)
+{
+  auto provider = std::make_unique<ManagedThreadServiceProvider>();
+  auto generation = provider->GetGeneration();
+  ASSERT_NE(generation, nullptr);
+  const auto initial = generation->Value;
+  EXPECT_NE(initial, ServiceProviderGeneration::Expired);
+
+  RegisterWithDefaults(*provider, ServiceLaunchPriority(1000), {1});
+  const auto afterRegister = generation->Value;
+  EXPECT_NE(afterRegister, initial);
+
+  auto none = provider->UnregisterPriorityGroup(ServiceLaunchPriority(1));
+  EXPECT_TRUE(none.empty());
+  EXPECT_EQ(generation->Value, afterRegister);
+
+  auto removed = provider->UnregisterPriorityGroup(ServiceLaunchPriority(1000));
+  EXPECT_EQ(removed.size(), 1u);
+  EXPECT_NE(generation->Value, afterRegister);
+
+  provider.reset();
+  EXPECT_EQ(generation->Value, ServiceProviderGeneration::Expired);
+}
+
+// Tests: GetProcessList returns every service in registration order and is only rebuilt on registration changes
+// Verifies: Repeated calls return the same storage, register and unregister update the list
+TEST(ManagedThreadServiceProviderTest, GetProcessList_IsCachedUntilRegistrationsChange)
+{
+  ManagedThreadServiceProvider provider;
+  EXPECT_TRUE(provider.GetProcessList().empty());
+
+  RegisterWithDefaults(provider, ServiceLaunchPriority(1000), {1, 2});
+  RegisterWithDefaults(provider, ServiceLaunchPriority(500), {3});
+
+  auto collectIds = [&provider]()
+  {
+    std::vector<int> ids;
+    for (IServiceControl* pService : provider.GetProcessList())
+    {
+      ids.push_back(dynamic_cast<MockServiceControl*>(pService)->GetId());
+    }
+    return ids;
+  };
+
+  EXPECT_EQ(collectIds(), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(provider.GetProcessList().data(), provider.GetProcessList().data());
+
+  auto removed = provider.UnregisterPriorityGroup(ServiceLaunchPriority(1000));
+  EXPECT_EQ(removed.size(), 2u);
+  EXPECT_EQ(collectIds(), (std::vector<int>{3}));
+}
+
 // ========================================
 // Thread-ID Validation Tests
 // ========================================
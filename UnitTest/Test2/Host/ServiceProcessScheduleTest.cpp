@@ -0,0 +1,338 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Framework/Host/ServiceProcessSchedule.hpp>
+#include <Test2/Framework/Host/ServiceProcessTiming.hpp>
+#include <Test2/Framework/Service/IServiceControl.hpp>
+#include <Test2/Framework/Service/ProcessResult.hpp>
+#include <Test2/Framework/Service/ServiceCreateInfo.hpp>
+#include <Test2/Framework/Service/ServiceInitResult.hpp>
+#include <Test2/Framework/Service/ServiceShutdownResult.hpp>
+#include <Test2/Framework/Service/ServiceTickPolicy.hpp>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+using namespace Test2;
+using namespace std::chrono_literals;
+
+namespace
+{
+  using Clock = ServiceProcessSchedule::Clock;
+
+  class TickPolicyService : public IServiceControl
+  {
+    ServiceTickPolicy m_policy;
+    ProcessResult m_processResult;
+
+  public:
+    int ProcessCallCount{0};
+    mutable int TickPolicyCallCount{0};
+
+    explicit TickPolicyService(const ServiceTickPolicy policy, const ProcessResult processResult = ProcessResult::NoSleepLimit())
+      : m_policy(policy)
+      , m_processResult(processResult)
+    {
+    }
+
+    boost::asio::awaitable<ServiceInitResult> InitAsync(const ServiceCreateInfo& /*createInfo*/) override
+    {
+      co_return ServiceInitResult::Success;
+    }
+
+    boost::asio::awaitable<ServiceShutdownResult> ShutdownAsync() override
+    {
+      co_return ServiceShutdownResult::Success;
+    }
+
+    ProcessResult Process() override
+    {
+      ++ProcessCallCount;
+      return m_processResult;
+    }
+
+    ServiceTickPolicy GetTickPolicy() const override
+    {
+      ++TickPolicyCallCount;
+      return m_policy;
+    }
+  };
+
+  // Any fixed time point works, the schedule only compares them
+  const Clock::time_point Start{1h};
+}
+
+
+TEST(ServiceProcessSchedule, Empty_ProcessReturnsNoSleepLimit)
+{
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild({}, Start);
+
+  EXPECT_EQ(schedule.GetScheduledCount(), 0u);
+  EXPECT_FALSE(schedule.HasPeriodicServices());
+  EXPECT_EQ(schedule.Process(Start).Status, ProcessStatus::NoSleepLimit);
+}
+
+TEST(ServiceProcessSchedule, Rebuild_QueriesPolicyOnce)
+{
+  TickPolicyService service(ServiceTickPolicy::EveryTick());
+  std::vector<IServiceControl*> services{&service};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start);
+  schedule.Process(Start);
+  schedule.Process(Start);
+
+  EXPECT_EQ(service.TickPolicyCallCount, 1);
+}
+
+TEST(ServiceProcessSchedule, NeverService_IsNotProcessed)
+{
+  TickPolicyService never(ServiceTickPolicy::Never(), ProcessResult::Quit());
+  TickPolicyService everyTick(ServiceTickPolicy::EveryTick());
+  std::vector<IServiceControl*> services{&never, &everyTick};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start);
+  const ProcessResult result = schedule.Process(Start);
+
+  EXPECT_EQ(schedule.GetScheduledCount(), 1u);
+  EXPECT_EQ(never.ProcessCallCount, 0);
+  EXPECT_EQ(everyTick.ProcessCallCount, 1);
+  EXPECT_EQ(result.Status, ProcessStatus::NoSleepLimit);
+}
+
+TEST(ServiceProcessSchedule, EveryTickService_IsProcessedOnEveryCall)
+{
+  TickPolicyService service(ServiceTickPolicy::EveryTick(), ProcessResult::SleepLimit(20ms));
+  std::vector<IServiceControl*> services{&service};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start);
+  schedule.Process(Start);
+  schedule.Process(Start);
+  const ProcessResult result = schedule.Process(Start);
+
+  EXPECT_FALSE(schedule.HasPeriodicServices());
+  EXPECT_EQ(service.ProcessCallCount, 3);
+  EXPECT_EQ(result.Status, ProcessStatus::SleepLimit);
+  EXPECT_EQ(result.Duration, 20ms);
+}
+
+TEST(ServiceProcessSchedule, PeriodicService_IsProcessedOnlyWhenDue)
+{
+  TickPolicyService service(ServiceTickPolicy::Periodic(100ms));
+  std::vector<IServiceControl*> services{&service};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start);
+  EXPECT_TRUE(schedule.HasPeriodicServices());
+
+  // New periodic services are due immediately
+  ProcessResult result = schedule.Process(Start);
+  EXPECT_EQ(service.ProcessCallCount, 1);
+  EXPECT_EQ(result.Status, ProcessStatus::SleepLimit);
+  EXPECT_EQ(result.Duration, 100ms);
+
+  result = schedule.Process(Start + 40ms);
+  EXPECT_EQ(service.ProcessCallCount, 1);
+  EXPECT_EQ(result.Duration, 60ms);
+
+  result = schedule.Process(Start + 100ms);
+  EXPECT_EQ(service.ProcessCallCount, 2);
+  EXPECT_EQ(result.Duration, 100ms);
+}
+
+TEST(ServiceProcessSchedule, PeriodicService_SleepLimitUsesEarliestDueService)
+{
+  TickPolicyService slow(ServiceTickPolicy::Periodic(300ms));
+  TickPolicyService fast(ServiceTickPolicy::Periodic(50ms));
+  std::vector<IServiceControl*> services{&slow, &fast};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start);
+
+  ProcessResult result = schedule.Process(Start);
+  EXPECT_EQ(slow.ProcessCallCount, 1);
+  EXPECT_EQ(fast.ProcessCallCount, 1);
+  EXPECT_EQ(result.Duration, 50ms);
+
+  result = schedule.Process(Start + 50ms);
+  EXPECT_EQ(slow.ProcessCallCount, 1);
+  EXPECT_EQ(fast.ProcessCallCount, 2);
+  EXPECT_EQ(result.Duration, 50ms);
+}
+
+TEST(ServiceProcessSchedule, PeriodicService_ServiceResultIsMerged)
+{
+  TickPolicyService service(ServiceTickPolicy::Periodic(100ms), ProcessResult::SleepLimit(10ms));
+  std::vector<IServiceControl*> services{&service};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start);
+  const ProcessResult result = schedule.Process(Start);
+
+  EXPECT_EQ(result.Status, ProcessStatus::SleepLimit);
+  EXPECT_EQ(result.Duration, 10ms);
+}
+
+TEST(ServiceProcessSchedule, PeriodicService_DoesNotCatchUpMissedTicks)
+{
+  TickPolicyService service(ServiceTickPolicy::Periodic(10ms));
+  std::vector<IServiceControl*> services{&service};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start);
+  schedule.Process(Start);
+
+  // Ten periods were missed, the service is ticked once and rescheduled relative to now
+  const ProcessResult result = schedule.Process(Start + 105ms);
+  EXPECT_EQ(service.ProcessCallCount, 2);
+  EXPECT_EQ(result.Duration, 10ms);
+}
+
+TEST(ServiceProcessSchedule, Rebuild_KeepsDueTimeOfScheduledServices)
+{
+  TickPolicyService existing(ServiceTickPolicy::Periodic(100ms));
+  TickPolicyService added(ServiceTickPolicy::Periodic(100ms));
+  std::vector<IServiceControl*> services{&existing};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start);
+  schedule.Process(Start);
+
+  services.push_back(&added);
+  schedule.Rebuild(services, Start + 30ms);
+  const ProcessResult result = schedule.Process(Start + 30ms);
+
+  EXPECT_EQ(existing.ProcessCallCount, 1);
+  EXPECT_EQ(added.ProcessCallCount, 1);
+  EXPECT_EQ(result.Duration, 70ms);
+}
+
+TEST(ServiceProcessSchedule, NonPositivePeriod_BehavesLikeEveryTick)
+{
+  EXPECT_EQ(ServiceTickPolicy::Periodic(0ms), ServiceTickPolicy::EveryTick());
+
+  // A hand built policy is handled the same way
+  TickPolicyService service(ServiceTickPolicy{ServiceTickMode::Periodic, -1ms});
+  std::vector<IServiceControl*> services{&service};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start);
+  schedule.Process(Start);
+  schedule.Process(Start);
+
+  EXPECT_FALSE(schedule.HasPeriodicServices());
+  EXPECT_EQ(service.ProcessCallCount, 2);
+}
+
+TEST(ServiceProcessSchedule, Timing_DisabledByDefault)
+{
+  TickPolicyService service(ServiceTickPolicy::EveryTick());
+  std::vector<IServiceControl*> services{&service};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start);
+  schedule.Process(Start);
+
+  EXPECT_FALSE(schedule.IsMeasuringTiming());
+  EXPECT_TRUE(schedule.GetTimings().empty());
+}
+
+TEST(ServiceProcessSchedule, Timing_CountsEveryProcessCall)
+{
+  TickPolicyService never(ServiceTickPolicy::Never());
+  TickPolicyService everyTick(ServiceTickPolicy::EveryTick());
+  TickPolicyService periodic(ServiceTickPolicy::Periodic(100ms));
+  std::vector<IServiceControl*> services{&everyTick, &never, &periodic};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start, true);
+  schedule.Process(Start);
+  schedule.Process(Start + 10ms);
+  schedule.Process(Start + 100ms);
+
+  // Never services are not listed, the rest in registration order
+  const std::vector<ServiceProcessTiming> timings = schedule.GetTimings();
+  ASSERT_EQ(timings.size(), 2u);
+  EXPECT_EQ(timings[0].ServiceType, std::type_index(typeid(TickPolicyService)));
+  EXPECT_EQ(timings[0].CallCount, 3u);
+  EXPECT_EQ(timings[1].CallCount, 2u);
+  EXPECT_LE(timings[0].P50, timings[0].P99);
+  EXPECT_LE(timings[0].P99, timings[0].Max);
+}
+
+TEST(ServiceProcessSchedule, Timing_KeptAcrossRebuild)
+{
+  TickPolicyService kept(ServiceTickPolicy::EveryTick());
+  TickPolicyService removed(ServiceTickPolicy::EveryTick());
+  TickPolicyService added(ServiceTickPolicy::EveryTick());
+  std::vector<IServiceControl*> services{&kept, &removed};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start, true);
+  schedule.Process(Start);
+  schedule.Process(Start);
+
+  services = {&added, &kept};
+  schedule.Rebuild(services, Start, true);
+  schedule.Process(Start);
+
+  const std::vector<ServiceProcessTiming> timings = schedule.GetTimings();
+  ASSERT_EQ(timings.size(), 2u);
+  EXPECT_EQ(timings[0].CallCount, 1u);
+  EXPECT_EQ(timings[1].CallCount, 3u);
+}
+
+TEST(ServiceProcessSchedule, Timing_RebuildWithoutTimingDropsTimings)
+{
+  TickPolicyService service(ServiceTickPolicy::EveryTick());
+  std::vector<IServiceControl*> services{&service};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start, true);
+  schedule.Process(Start);
+  schedule.Rebuild(services, Start);
+  schedule.Process(Start);
+
+  EXPECT_FALSE(schedule.IsMeasuringTiming());
+  EXPECT_TRUE(schedule.GetTimings().empty());
+
+  schedule.Rebuild(services, Start, true);
+  const std::vector<ServiceProcessTiming> timings = schedule.GetTimings();
+  ASSERT_EQ(timings.size(), 1u);
+  EXPECT_EQ(timings[0].CallCount, 0u);
+}
+
+TEST(ServiceProcessSchedule, Timing_ResetClearsCounts)
+{
+  TickPolicyService service(ServiceTickPolicy::EveryTick());
+  std::vector<IServiceControl*> services{&service};
+
+  ServiceProcessSchedule schedule;
+  schedule.Rebuild(services, Start, true);
+  schedule.Process(Start);
+  schedule.ResetTimings();
+
+  std::vector<ServiceProcessTiming> timings = schedule.GetTimings();
+  ASSERT_EQ(timings.size(), 1u);
+  EXPECT_EQ(timings[0].CallCount, 0u);
+  EXPECT_EQ(timings[0].Max, 0ns);
+
+  schedule.Process(Start);
+  timings = schedule.GetTimings();
+  EXPECT_EQ(timings[0].CallCount, 1u);
+}
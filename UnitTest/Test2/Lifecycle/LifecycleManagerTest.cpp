@@ -13,8 +13,10 @@
 
 #include <Common/AggregateException.hpp>
 #include <Test2/Framework/Config/ThreadGroupConfig.hpp>
+#include <Test2/Framework/Host/Managed/ManagedThreadRunMode.hpp>
 #include <Test2/Framework/Lifecycle/LifecycleManager.hpp>
 #include <Test2/Framework/Lifecycle/LifecycleManagerConfig.hpp>
+#include <Test2/Framework/Lifecycle/ServiceStartupMode.hpp>
 #include <Test2/Framework/Registry/ServiceLaunchPriority.hpp>
 #include <Test2/Framework/Registry/ServiceRegistrationRecord.hpp>
 #include <Test2/Framework/Registry/ServiceThreadGroupId.hpp>
@@ -27,6 +29,8 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/use_future.hpp>
 #include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <span>
@@ -1299,4 +1303,294 @@ namespace Test2
     EXPECT_EQ(errors.size(), 1u);
   }
 
+  // ============================================================================
+  // Phase 7: Concurrent Startup Tests
+  // ============================================================================
+
+  // Lets services on different threads wait for each other, which only succeeds if their InitAsync calls overlap
+  class StartupRendezvous
+  {
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::size_t m_expected;
+    std::size_t m_arrived{0};
+
+  public:
+    explicit StartupRendezvous(const std::size_t expected)
+      : m_expected(expected)
+    {
+    }
+
+    bool ArriveAndWait(const std::chrono::milliseconds timeout)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      ++m_arrived;
+      m_condition.notify_all();
+      return m_condition.wait_for(lock, timeout, [this] { return m_arrived >= m_expected; });
+    }
+  };
+
+  class RendezvousMockService : public IServiceControl
+  {
+  private:
+    StartupRendezvous* m_rendezvous;
+    std::atomic<bool> m_metOthers{false};
+
+  public:
+    explicit RendezvousMockService(StartupRendezvous* rendezvous)
+      : m_rendezvous(rendezvous)
+    {
+    }
+
+    boost::asio::awaitable<ServiceInitResult> InitAsync(const ServiceCreateInfo& /*createInfo*/) override
+    {
+      m_metOthers = m_rendezvous->ArriveAndWait(std::chrono::seconds(5));
+      co_return ServiceInitResult::Success;
+    }
+
+    boost::asio::awaitable<ServiceShutdownResult> ShutdownAsync() override
+    {
+      co_return ServiceShutdownResult::Success;
+    }
+
+    ProcessResult Process() override
+    {
+      return ProcessResult::NoSleepLimit();
+    }
+
+    bool MetOthers() const noexcept
+    {
+      return m_metOthers.load();
+    }
+  };
+
+  class RendezvousMockServiceFactory : public IServiceFactory
+  {
+  private:
+    std::shared_ptr<RendezvousMockService> m_service;
+
+  public:
+    explicit RendezvousMockServiceFactory(std::shared_ptr<RendezvousMockService> service)
+      : m_service(std::move(service))
+    {
+    }
+
+    std::span<const std::type_index> GetSupportedInterfaces() const override
+    {
+      static const std::type_index interfaces[] = {std::type_index(typeid(ITestInterface))};
+      return std::span<const std::type_index>(interfaces);
+    }
+
+    std::shared_ptr<IServiceControl> Create(const std::type_index& /*type*/, const ServiceCreateInfo& /*createInfo*/) override
+    {
+      return m_service;
+    }
+  };
+
+  TEST(LifecycleManager, StartServicesAsync_ConcurrentMode_ThreadGroupsOfSamePriorityStartTogether)
+  {
+    constexpr std::size_t ThreadGroupCount = 3;
+    StartupRendezvous rendezvous(ThreadGroupCount);
+
+    std::vector<std::shared_ptr<RendezvousMockService>> services;
+    std::vector<ServiceRegistrationRecord> registrations;
+    for (std::size_t i = 0; i < ThreadGroupCount; ++i)
+    {
+      services.push_back(std::make_shared<RendezvousMockService>(&rendezvous));
+      registrations.emplace_back(std::make_unique<RendezvousMockServiceFactory>(services.back()), ServiceLaunchPriority(1000),
+                                 ServiceThreadGroupId{static_cast<uint32_t>(i + 1)});
+    }
+
+    LifecycleManagerConfig config(ServiceStartupMode::Concurrent);
+    LifecycleManager manager(config, std::move(registrations));
+
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.StartServicesAsync(); });
+
+    // Every InitAsync was running at the same time as the others
+    for (const auto& service : services)
+    {
+      EXPECT_TRUE(service->MetOthers());
+    }
+
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.ShutdownServicesAsync(); });
+  }
+
+  TEST(LifecycleManager, StartServicesAsync_ConcurrentMode_PriorityRespected)
+  {
+    InitializationOrderTracker tracker;
+
+    auto highMain = std::make_shared<MockLifecycleService>("HighMain", &tracker);
+    auto highWorker = std::make_shared<MockLifecycleService>("HighWorker", &tracker);
+    auto lowMain = std::make_shared<MockLifecycleService>("LowMain", &tracker);
+    auto lowWorker = std::make_shared<MockLifecycleService>("LowWorker", &tracker);
+
+    ServiceThreadGroupId workerThreadGroup{1};
+
+    std::vector<ServiceRegistrationRecord> registrations;
+    registrations.emplace_back(std::make_unique<MockLifecycleServiceFactory>(lowWorker), ServiceLaunchPriority(100), workerThreadGroup);
+    registrations.emplace_back(std::make_unique<MockLifecycleServiceFactory>(highMain), ServiceLaunchPriority(1000),
+                               ThreadGroupConfig::MainThreadGroupId);
+    registrations.emplace_back(std::make_unique<MockLifecycleServiceFactory>(lowMain), ServiceLaunchPriority(100),
+                               ThreadGroupConfig::MainThreadGroupId);
+    registrations.emplace_back(std::make_unique<MockLifecycleServiceFactory>(highWorker), ServiceLaunchPriority(1000), workerThreadGroup);
+
+    LifecycleManagerConfig config(ServiceStartupMode::Concurrent);
+    LifecycleManager manager(config, std::move(registrations));
+
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.StartServicesAsync(); });
+
+    // The priority barrier still holds: both high priority services finish before any low priority service starts
+    ASSERT_EQ(tracker.Order.size(), 4u);
+    std::vector<std::string> highPriorityNames(tracker.Order.begin(), tracker.Order.begin() + 2);
+    std::vector<std::string> lowPriorityNames(tracker.Order.begin() + 2, tracker.Order.end());
+
+    EXPECT_TRUE(std::find(highPriorityNames.begin(), highPriorityNames.end(), "HighMain") != highPriorityNames.end());
+    EXPECT_TRUE(std::find(highPriorityNames.begin(), highPriorityNames.end(), "HighWorker") != highPriorityNames.end());
+    EXPECT_TRUE(std::find(lowPriorityNames.begin(), lowPriorityNames.end(), "LowMain") != lowPriorityNames.end());
+    EXPECT_TRUE(std::find(lowPriorityNames.begin(), lowPriorityNames.end(), "LowWorker") != lowPriorityNames.end());
+
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.ShutdownServicesAsync(); });
+  }
+
+  TEST(LifecycleManager, StartServicesAsync_ConcurrentMode_FailureRollsBackSiblingGroupsAndHigherPriorities)
+  {
+    InitializationOrderTracker initTracker;
+    InitializationOrderTracker shutdownTracker;
+
+    auto highService = std::make_shared<ShutdownTrackingMockService>("High", &initTracker, &shutdownTracker);
+    auto siblingService = std::make_shared<ShutdownTrackingMockService>("Sibling", &initTracker, &shutdownTracker);
+    auto failingService1 = std::make_shared<FailingMockService>("Failing1", "Worker 1 init failed", &initTracker);
+    auto failingService2 = std::make_shared<FailingMockService>("Failing2", "Worker 2 init failed", &initTracker);
+
+    std::vector<ServiceRegistrationRecord> registrations;
+    registrations.emplace_back(std::make_unique<ShutdownTrackingMockServiceFactory>(highService), ServiceLaunchPriority(1000),
+                               ThreadGroupConfig::MainThreadGroupId);
+    registrations.emplace_back(std::make_unique<ShutdownTrackingMockServiceFactory>(siblingService), ServiceLaunchPriority(100),
+                               ThreadGroupConfig::MainThreadGroupId);
+    registrations.emplace_back(std::make_unique<FailingMockServiceFactory>(failingService1), ServiceLaunchPriority(100), ServiceThreadGroupId{1});
+    registrations.emplace_back(std::make_unique<FailingMockServiceFactory>(failingService2), ServiceLaunchPriority(100), ServiceThreadGroupId{2});
+
+    LifecycleManagerConfig config(ServiceStartupMode::Concurrent);
+    LifecycleManager manager(config, std::move(registrations));
+
+    std::size_t errorCount = 0;
+    try
+    {
+      RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.StartServicesAsync(); });
+    }
+    catch (const Common::AggregateException& ex)
+    {
+      errorCount = ex.GetInnerExceptions().size();
+    }
+
+    // Both failing groups are reported, not just the first one
+    EXPECT_GE(errorCount, 2u);
+
+    // Every group of the failed level was attempted
+    EXPECT_EQ(initTracker.Order.size(), 4u);
+
+    // The sibling group that did start is rolled back before the higher priority level
+    ASSERT_EQ(shutdownTracker.Order.size(), 2u);
+    EXPECT_EQ(shutdownTracker.Order[0], "Sibling");
+    EXPECT_EQ(shutdownTracker.Order[1], "High");
+  }
+
+  // ============================================================================
+  // Phase 8: Managed Thread Process Tick Tests
+  // ============================================================================
+
+  namespace
+  {
+    constexpr ServiceThreadGroupId TickWorkerThreadGroup{1};
+
+    std::vector<ServiceRegistrationRecord> CreateWorkerRegistration(const std::shared_ptr<MockLifecycleService>& service)
+    {
+      std::vector<ServiceRegistrationRecord> registrations;
+      registrations.emplace_back(std::make_unique<MockLifecycleServiceFactory>(service), ServiceLaunchPriority(1000), TickWorkerThreadGroup);
+      return registrations;
+    }
+
+    bool WaitForProcessCallCount(const MockLifecycleService& service, const int minCount, const std::chrono::milliseconds timeout)
+    {
+      const auto deadline = std::chrono::steady_clock::now() + timeout;
+      while (service.GetProcessCallCount() < minCount)
+      {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+          return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      return true;
+    }
+  }
+
+  TEST(LifecycleManager, ThreadRunMode_Default_ProcessNotCalledOnManagedThread)
+  {
+    auto service = std::make_shared<MockLifecycleService>(ProcessResult::SleepLimit(std::chrono::milliseconds(1)));
+
+    LifecycleManagerConfig config;
+    LifecycleManager manager(config, CreateWorkerRegistration(service));
+
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.StartServicesAsync(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(service->GetProcessCallCount(), 0);
+
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.ShutdownServicesAsync(); });
+  }
+
+  TEST(LifecycleManager, ThreadRunMode_ProcessTick_SleepLimitDrivesRepeatedProcessCalls)
+  {
+    auto service = std::make_shared<MockLifecycleService>(ProcessResult::SleepLimit(std::chrono::milliseconds(1)));
+
+    LifecycleManagerConfig config(ServiceStartupMode::Sequential, ManagedThreadRunMode::ProcessTick);
+    LifecycleManager manager(config, CreateWorkerRegistration(service));
+
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.StartServicesAsync(); });
+
+    // Nothing is posted to the thread, so only the sleep limit timer can keep the ticks coming
+    EXPECT_TRUE(WaitForProcessCallCount(*service, 5, std::chrono::seconds(2)));
+
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.ShutdownServicesAsync(); });
+    EXPECT_TRUE(service->IsShutdown());
+  }
+
+  TEST(LifecycleManager, ThreadRunMode_ProcessTick_NoSleepLimitWaitsForWorkInsteadOfSpinning)
+  {
+    auto service = std::make_shared<MockLifecycleService>(ProcessResult::NoSleepLimit());
+
+    LifecycleManagerConfig config(ServiceStartupMode::Sequential, ManagedThreadRunMode::ProcessTick);
+    LifecycleManager manager(config, CreateWorkerRegistration(service));
+
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.StartServicesAsync(); });
+    EXPECT_TRUE(WaitForProcessCallCount(*service, 1, std::chrono::seconds(2)));
+
+    const int countAfterStart = service->GetProcessCallCount();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // An idle thread sleeps until work is posted, a spinning loop would have called Process() many thousand times
+    EXPECT_EQ(service->GetProcessCallCount(), countAfterStart);
+
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.ShutdownServicesAsync(); });
+    EXPECT_TRUE(service->IsShutdown());
+  }
+
+  TEST(LifecycleManager, ThreadRunMode_ProcessTick_QuitStopsProcessCallsAndShutdownStillWorks)
+  {
+    auto service = std::make_shared<MockLifecycleService>(ProcessResult::Quit());
+
+    LifecycleManagerConfig config(ServiceStartupMode::Sequential, ManagedThreadRunMode::ProcessTick);
+    LifecycleManager manager(config, CreateWorkerRegistration(service));
+
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.StartServicesAsync(); });
+    EXPECT_TRUE(WaitForProcessCallCount(*service, 1, std::chrono::seconds(2)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(service->GetProcessCallCount(), 1);
+
+    // The thread keeps serving handlers after Quit, so the regular shutdown path still reaches it
+    RunAsyncWithPolling(manager, [&manager]() -> boost::asio::awaitable<void> { co_await manager.ShutdownServicesAsync(); });
+    EXPECT_TRUE(service->IsShutdown());
+  }
 }
@@ -0,0 +1,230 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+
+#include "../../../src/Test2/Framework/Host/Managed/ManagedThreadServiceProvider.hpp"
+#include <Test2/Framework/Exception/UnknownServiceException.hpp>
+#include <Test2/Framework/Host/ServiceInstanceInfo.hpp>
+#include <Test2/Framework/Provider/ServiceHandle.hpp>
+#include <Test2/Framework/Provider/ServiceProvider.hpp>
+#include <Test2/Framework/Service/IServiceControl.hpp>
+#include <Test2/Framework/Service/ProcessResult.hpp>
+#include <Test2/Framework/Service/ServiceCreateInfo.hpp>
+#include <Test2/Framework/Service/ServiceInitResult.hpp>
+#include <Test2/Framework/Service/ServiceShutdownResult.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <typeindex>
+#include <vector>
+
+namespace Test2
+{
+  namespace
+  {
+    class ITestService : public IService
+    {
+    public:
+      virtual int GetValue() const = 0;
+    };
+
+    class TestServiceControl final
+      : public IServiceControl
+      , public ITestService
+    {
+      int m_value;
+
+    public:
+      explicit TestServiceControl(int value)
+        : m_value(value)
+      {
+      }
+
+      int GetValue() const override
+      {
+        return m_value;
+      }
+
+      boost::asio::awaitable<ServiceInitResult> InitAsync(const ServiceCreateInfo& /*creationInfo*/) override
+      {
+        co_return ServiceInitResult::Success;
+      }
+
+      boost::asio::awaitable<ServiceShutdownResult> ShutdownAsync() override
+      {
+        co_return ServiceShutdownResult::Success;
+      }
+
+      ProcessResult Process() override
+      {
+        return ProcessResult::NoSleepLimit();
+      }
+    };
+
+    // Forwards to a ManagedThreadServiceProvider and counts the type based lookups
+    class CountingServiceProvider final : public IServiceProvider
+    {
+      std::shared_ptr<ManagedThreadServiceProvider> m_provider;
+      bool m_trackGeneration;
+
+    public:
+      mutable int LookupCount = 0;
+
+      explicit CountingServiceProvider(std::shared_ptr<ManagedThreadServiceProvider> provider, const bool trackGeneration = true)
+        : m_provider(std::move(provider))
+        , m_trackGeneration(trackGeneration)
+      {
+      }
+
+      std::shared_ptr<IService> GetService(const std::type_info& type) const override
+      {
+        ++LookupCount;
+        return m_provider->GetService(type);
+      }
+
+      std::shared_ptr<IService> TryGetService(const std::type_info& type) const override
+      {
+        ++LookupCount;
+        return m_provider->TryGetService(type);
+      }
+
+      bool TryGetServices(const std::type_info& type, std::vector<std::shared_ptr<IService>>& rServices) const override
+      {
+        ++LookupCount;
+        return m_provider->TryGetServices(type, rServices);
+      }
+
+      std::shared_ptr<const ServiceProviderGeneration> GetGeneration() const override
+      {
+        return m_trackGeneration ? m_provider->GetGeneration() : nullptr;
+      }
+    };
+
+    ServiceInstanceInfo CreateServiceInfo(std::shared_ptr<TestServiceControl> service)
+    {
+      return {std::move(service), {std::type_index(typeid(ITestService))}};
+    }
+  }
+
+  class ServiceHandleTest : public ::testing::Test
+  {
+  protected:
+    std::shared_ptr<ManagedThreadServiceProvider> m_managedProvider = std::make_shared<ManagedThreadServiceProvider>();
+    std::shared_ptr<CountingServiceProvider> m_countingProvider = std::make_shared<CountingServiceProvider>(m_managedProvider);
+    ServiceProvider m_provider{m_countingProvider};
+  };
+
+  TEST_F(ServiceHandleTest, Get_ResolvesOnceAndReusesTheResult)
+  {
+    auto service = std::make_shared<TestServiceControl>(42);
+    m_managedProvider->RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateServiceInfo(service)});
+
+    auto handle = m_provider.GetServiceHandle<ITestService>();
+    EXPECT_EQ(m_countingProvider->LookupCount, 0);
+
+    for (int i = 0; i < 10; ++i)
+    {
+      EXPECT_EQ(handle->GetValue(), 42);
+    }
+    EXPECT_EQ(&handle.Get(), static_cast<ITestService*>(service.get()));
+    EXPECT_EQ(m_countingProvider->LookupCount, 1);
+    EXPECT_TRUE(handle.IsCurrent());
+  }
+
+  TEST_F(ServiceHandleTest, Get_AfterAnotherGroupIsRegistered_ResolvesAgain)
+  {
+    m_managedProvider->RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateServiceInfo(std::make_shared<TestServiceControl>(1))});
+
+    auto handle = m_provider.GetServiceHandle<ITestService>();
+    EXPECT_EQ(handle->GetValue(), 1);
+
+    m_managedProvider->RegisterPriorityGroup(ServiceLaunchPriority(500), {{std::make_shared<TestServiceControl>(2), {std::type_index(typeid(IService))}}});
+    EXPECT_FALSE(handle.IsCurrent());
+
+    EXPECT_EQ(handle->GetValue(), 1);
+    EXPECT_EQ(m_countingProvider->LookupCount, 2);
+    EXPECT_TRUE(handle.IsCurrent());
+  }
+
+  TEST_F(ServiceHandleTest, TryGet_AfterServiceIsUnregistered_ReturnsNull)
+  {
+    m_managedProvider->RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateServiceInfo(std::make_shared<TestServiceControl>(1))});
+
+    auto handle = m_provider.GetServiceHandle<ITestService>();
+    ASSERT_NE(handle.TryGet(), nullptr);
+
+    auto removed = m_managedProvider->UnregisterPriorityGroup(ServiceLaunchPriority(1000));
+    EXPECT_EQ(removed.size(), 1u);
+
+    EXPECT_EQ(handle.TryGet(), nullptr);
+    EXPECT_THROW(handle.Get(), UnknownServiceException);
+  }
+
+  TEST_F(ServiceHandleTest, TryGet_WhenServiceIsMissing_CachesTheMissUntilRegistrationsChange)
+  {
+    auto handle = m_provider.GetServiceHandle<ITestService>();
+    EXPECT_EQ(handle.TryGet(), nullptr);
+    EXPECT_EQ(handle.TryGet(), nullptr);
+    EXPECT_EQ(m_countingProvider->LookupCount, 1);
+
+    m_managedProvider->RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateServiceInfo(std::make_shared<TestServiceControl>(7))});
+
+    ASSERT_NE(handle.TryGet(), nullptr);
+    EXPECT_EQ(handle.TryGet()->GetValue(), 7);
+    EXPECT_EQ(m_countingProvider->LookupCount, 2);
+  }
+
+  TEST_F(ServiceHandleTest, Get_WhenProviderDoesNotTrackGeneration_ResolvesEveryTime)
+  {
+    m_managedProvider->RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateServiceInfo(std::make_shared<TestServiceControl>(3))});
+    auto untracked = std::make_shared<CountingServiceProvider>(m_managedProvider, false);
+    ServiceProvider provider(untracked);
+
+    auto handle = provider.GetServiceHandle<ITestService>();
+    EXPECT_EQ(handle->GetValue(), 3);
+    EXPECT_EQ(handle->GetValue(), 3);
+
+    EXPECT_FALSE(handle.IsCurrent());
+    EXPECT_EQ(untracked->LookupCount, 2);
+  }
+
+  TEST_F(ServiceHandleTest, Get_AfterProviderIsDestroyed_ThrowsLikeServiceProvider)
+  {
+    auto service = std::make_shared<TestServiceControl>(1);
+    m_managedProvider->RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateServiceInfo(service)});
+
+    auto handle = m_provider.GetServiceHandle<ITestService>();
+    EXPECT_EQ(handle->GetValue(), 1);
+
+    m_countingProvider.reset();
+    m_managedProvider.reset();
+
+    EXPECT_FALSE(handle.IsCurrent());
+    EXPECT_EQ(handle.TryGet(), nullptr);
+    EXPECT_THROW(handle.Get(), std::runtime_error);
+  }
+
+  TEST_F(ServiceHandleTest, Reset_DropsTheCachedService)
+  {
+    auto service = std::make_shared<TestServiceControl>(1);
+    m_managedProvider->RegisterPriorityGroup(ServiceLaunchPriority(1000), {CreateServiceInfo(service)});
+
+    auto handle = m_provider.GetServiceHandle<ITestService>();
+    EXPECT_EQ(handle.TryGetShared().get(), static_cast<ITestService*>(service.get()));
+
+    handle.Reset();
+    EXPECT_FALSE(handle.IsCurrent());
+    EXPECT_EQ(handle->GetValue(), 1);
+    EXPECT_EQ(m_countingProvider->LookupCount, 2);
+  }
+}
@@ -35,6 +35,35 @@ namespace Test2
     virtual std::string GetName() const = 0;
   };
 
+  // Interface that opts in to the compile-time ServiceId lookup
+  class ITestIdInterface : public IService
+  {
+  public:
+    static constexpr ServiceId Id{3};
+
+    ~ITestIdInterface() override = default;
+    virtual int GetValue() const = 0;
+  };
+
+  static_assert(HasServiceId<ITestIdInterface>);
+  static_assert(!HasServiceId<ITestInterface1>);
+
+  class MockIdServiceImpl : public ITestIdInterface
+  {
+    int m_value;
+
+  public:
+    explicit MockIdServiceImpl(int value)
+      : m_value(value)
+    {
+    }
+
+    int GetValue() const override
+    {
+      return m_value;
+    }
+  };
+
   // Concrete mock service implementing ITestInterface1
   class MockServiceImpl : public ITestInterface1
   {
@@ -60,8 +89,24 @@ namespace Test2
     std::vector<std::shared_ptr<IService>> m_services;
     bool m_returnNullOnTryGet = false;
     bool m_throwOnGet = false;
+    ServiceId m_boundId;
+    const std::type_info* m_pBoundType = nullptr;
+    std::shared_ptr<IService> m_boundService;
+    mutable int m_typeLookupCount = 0;
 
   public:
+    void SetBoundService(ServiceId id, const std::type_info& type, std::shared_ptr<IService> service)
+    {
+      m_boundId = id;
+      m_pBoundType = &type;
+      m_boundService = std::move(service);
+    }
+
+    int GetTypeLookupCount() const
+    {
+      return m_typeLookupCount;
+    }
+
     void SetService(std::shared_ptr<IService> service)
     {
       m_service = std::move(service);
@@ -84,6 +129,7 @@ namespace Test2
 
     std::shared_ptr<IService> GetService(const std::type_info& /*type*/) const override
     {
+      ++m_typeLookupCount;
       if (m_throwOnGet)
       {
         throw UnknownServiceException("Service not found");
@@ -93,6 +139,7 @@ namespace Test2
 
     std::shared_ptr<IService> TryGetService(const std::type_info& /*type*/) const override
     {
+      ++m_typeLookupCount;
       if (m_returnNullOnTryGet)
       {
         return nullptr;
@@ -109,6 +156,11 @@ namespace Test2
       rServices = m_services;
       return true;
     }
+
+    std::shared_ptr<IService> TryGetUniqueService(const ServiceId id, const std::type_info& type) const override
+    {
+      return id == m_boundId && m_pBoundType == &type ? m_boundService : nullptr;
+    }
   };
 
   // Test fixture
@@ -353,6 +405,70 @@ namespace Test2
     EXPECT_EQ(results[1]->GetValue(), 100);    // Added
   }
 
+  // ==================== ServiceId Tests ====================
+
+  TEST_F(ServiceProviderTemplateTest, GetService_WhenServiceIdIsBound_SkipsTypeLookup)
+  {
+    auto mockService = std::make_shared<MockIdServiceImpl>(7);
+    mockProvider->SetBoundService(ITestIdInterface::Id, typeid(ITestIdInterface), mockService);
+
+    ServiceProvider provider = CreateServiceProvider();
+    auto result = provider.GetService<ITestIdInterface>();
+
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result.get(), mockService.get());
+    EXPECT_EQ(result->GetValue(), 7);
+    EXPECT_EQ(mockProvider->GetTypeLookupCount(), 0);
+  }
+
+  TEST_F(ServiceProviderTemplateTest, TryGetService_WhenServiceIdIsBound_SkipsTypeLookup)
+  {
+    auto mockService = std::make_shared<MockIdServiceImpl>(7);
+    mockProvider->SetBoundService(ITestIdInterface::Id, typeid(ITestIdInterface), mockService);
+
+    ServiceProvider provider = CreateServiceProvider();
+    auto result = provider.TryGetService<ITestIdInterface>();
+
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result.get(), mockService.get());
+    EXPECT_EQ(mockProvider->GetTypeLookupCount(), 0);
+  }
+
+  TEST_F(ServiceProviderTemplateTest, GetService_WhenServiceIdIsNotBound_FallsBackToTypeLookup)
+  {
+    auto mockService = std::make_shared<MockIdServiceImpl>(7);
+    mockProvider->SetService(mockService);
+
+    ServiceProvider provider = CreateServiceProvider();
+    auto result = provider.GetService<ITestIdInterface>();
+
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetValue(), 7);
+    EXPECT_EQ(mockProvider->GetTypeLookupCount(), 1);
+  }
+
+  TEST_F(ServiceProviderTemplateTest, GetService_WhenServiceIdIsBoundToOtherType_FallsBackToTypeLookup)
+  {
+    auto mockService = std::make_shared<MockIdServiceImpl>(7);
+    mockProvider->SetBoundService(ITestIdInterface::Id, typeid(ITestInterface1), mockService);
+    mockProvider->SetThrowOnGet(true);
+
+    ServiceProvider provider = CreateServiceProvider();
+
+    EXPECT_THROW(provider.GetService<ITestIdInterface>(), UnknownServiceException);
+    EXPECT_EQ(mockProvider->GetTypeLookupCount(), 1);
+  }
+
+  TEST_F(ServiceProviderTemplateTest, GetService_WhenProviderExpiredAndInterfaceHasServiceId_BehavesLikeTypeLookup)
+  {
+    mockProvider->SetBoundService(ITestIdInterface::Id, typeid(ITestIdInterface), std::make_shared<MockIdServiceImpl>(7));
+    ServiceProvider provider = CreateServiceProvider();
+    mockProvider.reset();    // Expire the provider
+
+    EXPECT_EQ(provider.TryGetService<ITestIdInterface>(), nullptr);
+    EXPECT_THROW(provider.GetService<ITestIdInterface>(), std::runtime_error);
+  }
+
   // ==================== ServiceCastException Tests ====================
 
   TEST(ServiceCastExceptionTest, What_ReturnsDescriptiveMessage)
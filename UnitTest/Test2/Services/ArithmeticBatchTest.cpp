@@ -0,0 +1,174 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Framework/Provider/IServiceProvider.hpp>
+#include <Test2/Framework/Provider/ServiceProvider.hpp>
+#include <Test2/Framework/Service/ServiceCreateInfo.hpp>
+#include <Test2/Services/Add/AddService.hpp>
+#include <Test2/Services/BatchArithmetic.hpp>
+#include <Test2/Services/Divide/DivideService.hpp>
+#include <Test2/Services/Multiply/MultiplyService.hpp>
+#include <Test2/Services/ServiceConfig.hpp>
+#include <Test2/Services/Subtract/SubtractService.hpp>
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_future.hpp>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace Test2;
+
+namespace
+{
+  ServiceCreateInfo CreateInfo()
+  {
+    return ServiceCreateInfo(ServiceProvider(std::weak_ptr<IServiceProvider>{}));
+  }
+
+  std::vector<double> RunBatch(boost::asio::awaitable<std::vector<double>> work)
+  {
+    boost::asio::io_context io;
+    auto future = boost::asio::co_spawn(io, std::move(work), boost::asio::use_future);
+    io.run();
+    return future.get();
+  }
+
+  /// @brief Runs a scalar operation on every pair of elements, all calls concurrently on one io_context.
+  template <typename TOperation>
+  std::vector<double> RunScalar(const std::vector<double>& left, const std::vector<double>& right, TOperation operation)
+  {
+    boost::asio::io_context io;
+    std::vector<std::future<double>> futures;
+    futures.reserve(left.size());
+    for (std::size_t i = 0; i < left.size(); ++i)
+    {
+      futures.push_back(boost::asio::co_spawn(io, operation(left[i], right[i]), boost::asio::use_future));
+    }
+    io.run();
+
+    std::vector<double> results;
+    results.reserve(futures.size());
+    for (std::future<double>& rFuture : futures)
+    {
+      results.push_back(rFuture.get());
+    }
+    return results;
+  }
+
+  const std::vector<double> Left{1.0, 2.0, 3.0, 4.0, 5.0};
+  const std::vector<double> Right{2.0, 4.0, 8.0, 16.0, 32.0};
+}
+
+// ========================================
+// BatchArithmetic
+// ========================================
+
+TEST(BatchArithmetic, Apply_CombinesElementsInOrder)
+{
+  // An odd size that is not a multiple of any vector width exercises the loop tail
+  std::vector<double> a(1001);
+  std::vector<double> b(1001);
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    a[i] = static_cast<double>(i);
+    b[i] = 0.5;
+  }
+
+  const std::vector<double> result = BatchArithmetic::Apply(a, b, [](const double lhs, const double rhs) { return lhs * rhs + 1.0; });
+
+  ASSERT_EQ(result.size(), a.size());
+  for (std::size_t i = 0; i < result.size(); ++i)
+  {
+    EXPECT_DOUBLE_EQ(result[i], static_cast<double>(i) * 0.5 + 1.0) << i;
+  }
+}
+
+TEST(BatchArithmetic, Apply_EmptyOperandsGiveEmptyResult)
+{
+  EXPECT_TRUE(BatchArithmetic::Apply({}, {}, [](const double lhs, const double rhs) { return lhs + rhs; }).empty());
+}
+
+TEST(BatchArithmetic, Apply_SizeMismatchThrows)
+{
+  const std::vector<double> shorter{1.0};
+  EXPECT_THROW(BatchArithmetic::Apply(Left, shorter, [](const double lhs, const double rhs) { return lhs + rhs; }), std::invalid_argument);
+}
+
+// ========================================
+// Services
+// ========================================
+
+TEST(ArithmeticBatch, AddAsync_ConcurrentCallsShareOneDelay)
+{
+  constexpr int CallCount = 10;
+  constexpr std::chrono::milliseconds Delay(Config::ADD_SERVICE_DELAY_MS);
+  AddService add(CreateInfo());
+  boost::asio::io_context io;
+  std::vector<std::future<double>> results;
+  for (int i = 0; i < CallCount; ++i)
+  {
+    results.push_back(boost::asio::co_spawn(io, add.AddAsync(i, 1.0), boost::asio::use_future));
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  io.run();
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  for (int i = 0; i < CallCount; ++i)
+  {
+    EXPECT_DOUBLE_EQ(results[i].get(), i + 1.0);
+  }
+  // The timers of all calls run on the one thread at the same time, awaiting them one after the other would take CallCount delays
+  EXPECT_GE(elapsed, Delay);
+  EXPECT_LT(elapsed, Delay * (CallCount / 2));
+}
+
+TEST(ArithmeticBatch, ManyAsync_MatchesScalarOperations)
+{
+  AddService add(CreateInfo());
+  SubtractService subtract(CreateInfo());
+  MultiplyService multiply(CreateInfo());
+  DivideService divide(CreateInfo());
+
+  const std::vector<double> sums = RunBatch(add.AddManyAsync(Left, Right));
+  const std::vector<double> differences = RunBatch(subtract.SubtractManyAsync(Left, Right));
+  const std::vector<double> products = RunBatch(multiply.MultiplyManyAsync(Left, Right));
+  const std::vector<double> quotients = RunBatch(divide.DivideManyAsync(Left, Right));
+
+  EXPECT_EQ(sums, RunScalar(Left, Right, [&add](const double a, const double b) { return add.AddAsync(a, b); }));
+  EXPECT_EQ(differences, RunScalar(Left, Right, [&subtract](const double a, const double b) { return subtract.SubtractAsync(a, b); }));
+  EXPECT_EQ(products, RunScalar(Left, Right, [&multiply](const double a, const double b) { return multiply.MultiplyAsync(a, b); }));
+  EXPECT_EQ(quotients, RunScalar(Left, Right, [&divide](const double a, const double b) { return divide.DivideAsync(a, b); }));
+}
+
+TEST(ArithmeticBatch, ManyAsync_SizeMismatchThrows)
+{
+  AddService add(CreateInfo());
+  const std::vector<double> shorter{1.0, 2.0};
+
+  EXPECT_THROW(RunBatch(add.AddManyAsync(Left, shorter)), std::invalid_argument);
+}
+
+TEST(ArithmeticBatch, DivideManyAsync_ZeroDivisorThrows)
+{
+  DivideService divide(CreateInfo());
+  const std::vector<double> divisors{1.0, 2.0, 0.0, 4.0, 5.0};
+
+  EXPECT_THROW(RunBatch(divide.DivideManyAsync(Left, divisors)), std::runtime_error);
+}
@@ -0,0 +1,114 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include "../../../../src/Test2/Framework/Host/Managed/ManagedThreadServiceProvider.hpp"
+#include <Test2/Framework/Host/ServiceInstanceInfo.hpp>
+#include <Test2/Framework/Service/ServiceCreateInfo.hpp>
+#include <Test2/Services/Add/IAddService.hpp>
+#include <Test2/Services/Calculator/CalculatorService.hpp>
+#include <Test2/Services/Divide/IDivideService.hpp>
+#include <Test2/Services/Multiply/IMultiplyService.hpp>
+#include <Test2/Services/Subtract/ISubtractService.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_future.hpp>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <vector>
+#include "../../Util/AllocationCounter.hpp"
+#include "MockArithmeticService.hpp"
+
+using namespace Test2;
+
+namespace
+{
+  constexpr int WarmUpCallCount = 16;
+  constexpr int MeasuredCallCount = 100;
+
+  // 25 operands and 24 operators, with enough nesting to give the concurrent evaluator independent subtrees
+  const std::string Expression = "(1 + 2) * (3 - 4) / (5 + 6) + (7 * 8 - 9) / (10 + 11 * 12) - ((13 + 14) * (15 - 16) + 17 / 18) "
+                                 "* (19 + 20) - 21 * 22 + 23 / 24 - 25";
+
+  class CalculatorAllocationTest : public ::testing::Test
+  {
+  protected:
+    std::shared_ptr<ManagedThreadServiceProvider> m_provider = std::make_shared<ManagedThreadServiceProvider>();
+    spdlog::level::level_enum m_logLevel{spdlog::get_level()};
+
+    void SetUp() override
+    {
+      // Logging is not what is being measured
+      spdlog::set_level(spdlog::level::off);
+
+      std::vector<ServiceInstanceInfo> services;
+      // A zero call delay completes every call without suspending, so only the calculator's own work is measured
+      services.push_back({std::make_shared<MockArithmeticService>(std::chrono::steady_clock::duration::zero()),
+                          {std::type_index(typeid(IAddService)), std::type_index(typeid(ISubtractService)),
+                           std::type_index(typeid(IMultiplyService)), std::type_index(typeid(IDivideService))}});
+      m_provider->RegisterPriorityGroup(ServiceLaunchPriority(1000), std::move(services));
+    }
+
+    void TearDown() override
+    {
+      spdlog::set_level(m_logLevel);
+    }
+
+    /// @brief Evaluates the expression repeatedly with the result cache disabled and returns the average allocations per evaluation.
+    double CountAllocationsPerEvaluation(const CalculatorEvaluationMode mode)
+    {
+      CalculatorService calculator(ServiceCreateInfo(ServiceProvider(m_provider)), mode, 0);
+      boost::asio::io_context io;
+      auto future = boost::asio::co_spawn(
+        io,
+        [&calculator]() -> boost::asio::awaitable<std::uint64_t>
+        {
+          for (int i = 0; i < WarmUpCallCount; ++i)
+          {
+            co_await calculator.EvaluateAsync(Expression);
+          }
+
+          AllocationCounter counter;
+          for (int i = 0; i < MeasuredCallCount; ++i)
+          {
+            co_await calculator.EvaluateAsync(Expression);
+          }
+          co_return counter.GetCount();
+        },
+        boost::asio::use_future);
+      io.run();
+      return static_cast<double>(future.get()) / MeasuredCallCount;
+    }
+  };
+}
+
+
+TEST_F(CalculatorAllocationTest, Sequential_DoesNotAllocatePerOperator)
+{
+  const double allocations = CountAllocationsPerEvaluation(CalculatorEvaluationMode::Sequential);
+
+  // The expression copy, the value stack and a few frames, the 24 service calls reuse recycled frames
+  EXPECT_LE(allocations, 8.0);
+}
+
+TEST_F(CalculatorAllocationTest, Concurrent_OnlyJoinsAllocate)
+{
+  const double allocations = CountAllocationsPerEvaluation(CalculatorEvaluationMode::Concurrent);
+
+  // Ten operators have two non-constant operands and spawn one of them, everything else is evaluated inline
+  EXPECT_LE(allocations, 8.0 + 10 * 8.0);
+}
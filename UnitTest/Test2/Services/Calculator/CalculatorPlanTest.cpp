@@ -0,0 +1,391 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Services/Calculator/CalculatorPlan.hpp>
+#include <Test2/Services/Calculator/CalculatorPlanCache.hpp>
+#include <Test2/Services/Calculator/CalculatorResultCache.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Test2;
+
+namespace
+{
+  // Runs a plan locally, the same way CalculatorService does with its arithmetic services
+  double Evaluate(const CalculatorPlan& plan)
+  {
+    const auto instructions = plan.GetInstructions();
+    std::vector<double> stack;
+    std::vector<double> results(instructions.size());
+    for (std::size_t index = 0; index < instructions.size(); ++index)
+    {
+      const CalculatorInstruction& instruction = instructions[index];
+      if (instruction.OpCode == CalculatorOpCode::Push || instruction.OpCode == CalculatorOpCode::Load)
+      {
+        if (instruction.OpCode == CalculatorOpCode::Load)
+        {
+          EXPECT_LT(instruction.LeftOperand, index);
+          EXPECT_TRUE(instructions[instruction.LeftOperand].IsShared);
+        }
+        stack.push_back(instruction.OpCode == CalculatorOpCode::Push ? instruction.Value : results[instruction.LeftOperand]);
+        results[index] = stack.back();
+        EXPECT_LE(stack.size(), plan.GetMaxStackDepth());
+        continue;
+      }
+      const double right = stack.back();
+      stack.pop_back();
+      double& rLeft = stack.back();
+      switch (instruction.OpCode)
+      {
+      case CalculatorOpCode::Add:
+        rLeft += right;
+        break;
+      case CalculatorOpCode::Subtract:
+        rLeft -= right;
+        break;
+      case CalculatorOpCode::Multiply:
+        rLeft *= right;
+        break;
+      case CalculatorOpCode::Divide:
+        rLeft /= right;
+        break;
+      default:
+        ADD_FAILURE() << "Unexpected opcode";
+      }
+      results[index] = rLeft;
+    }
+    EXPECT_EQ(stack.size(), 1u);
+    return stack.back();
+  }
+
+  std::vector<CalculatorOpCode> GetOpCodes(const CalculatorPlan& plan)
+  {
+    std::vector<CalculatorOpCode> opCodes;
+    for (const CalculatorInstruction& instruction : plan.GetInstructions())
+    {
+      opCodes.push_back(instruction.OpCode);
+    }
+    return opCodes;
+  }
+}
+
+// ========================================
+// CalculatorPlan
+// ========================================
+
+TEST(CalculatorPlan, Compile_RespectsPrecedence)
+{
+  const CalculatorPlan plan = CalculatorPlan::Compile("2 + 3 * 4");
+
+  using enum CalculatorOpCode;
+  EXPECT_EQ(GetOpCodes(plan), (std::vector<CalculatorOpCode>{Push, Push, Push, Multiply, Add}));
+  EXPECT_EQ(plan.GetMaxStackDepth(), 3u);
+  EXPECT_DOUBLE_EQ(Evaluate(plan), 14.0);
+}
+
+TEST(CalculatorPlan, Compile_IsLeftAssociative)
+{
+  const CalculatorPlan plan = CalculatorPlan::Compile("10 - 4 - 3");
+
+  using enum CalculatorOpCode;
+  EXPECT_EQ(GetOpCodes(plan), (std::vector<CalculatorOpCode>{Push, Push, Subtract, Push, Subtract}));
+  EXPECT_EQ(plan.GetMaxStackDepth(), 2u);
+  EXPECT_DOUBLE_EQ(Evaluate(plan), 3.0);
+}
+
+TEST(CalculatorPlan, Compile_ParenthesesAndNegativeNumbers)
+{
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorPlan::Compile("-2 * (3 - -1)")), -8.0);
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorPlan::Compile("(1 + 2) * (3 + 4) / 7")), 3.0);
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorPlan::Compile("  .5+1.25 ")), 1.75);
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorPlan::Compile("((42))")), 42.0);
+}
+
+TEST(CalculatorPlan, Compile_ParsesNumbersInPlace)
+{
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorPlan::Compile("5.")), 5.0);
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorPlan::Compile("00012.50")), 12.5);
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorPlan::Compile("0.1 + 0.2")), 0.1 + 0.2);
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorPlan::Compile("123456789.125*-2")), -246913578.25);
+
+  // A view into a larger buffer is parsed without reading past its end
+  const std::string buffer = "12+34567";
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorPlan::Compile(std::string_view(buffer).substr(0, 5))), 46.0);
+}
+
+TEST(CalculatorPlan, Compile_RejectsNumbersOutsidePlainDecimalSyntax)
+{
+  EXPECT_THROW(CalculatorPlan::Compile("1e5"), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("-inf"), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("nan"), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("0x10"), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("1" + std::string(400, '0')), std::invalid_argument);
+}
+
+TEST(CalculatorPlan, Compile_LinksOperatorsToTheirOperands)
+{
+  // 0:1 1:2 2:* 3:3 4:4 5:* 6:+
+  const CalculatorPlan plan = CalculatorPlan::Compile("1 * 2 + 3 * 4");
+  const auto instructions = plan.GetInstructions();
+
+  ASSERT_EQ(instructions.size(), 7u);
+  EXPECT_EQ(instructions[2].LeftOperand, 0u);
+  EXPECT_EQ(instructions[5].LeftOperand, 3u);
+  // The right operand of the final add is the multiply before it, the left one is the first multiply
+  EXPECT_EQ(instructions[6].LeftOperand, 2u);
+
+  // 0:1 1:2 2:3 3:* 4:4 5:- 6:+
+  const CalculatorPlan nested = CalculatorPlan::Compile("1 + (2 * 3 - 4)");
+  const auto nestedInstructions = nested.GetInstructions();
+  ASSERT_EQ(nestedInstructions.size(), 7u);
+  EXPECT_EQ(nestedInstructions[3].LeftOperand, 1u);
+  EXPECT_EQ(nestedInstructions[5].LeftOperand, 3u);
+  EXPECT_EQ(nestedInstructions[6].LeftOperand, 0u);
+}
+
+TEST(CalculatorPlan, Compile_LoadsRepeatedSubexpression)
+{
+  const CalculatorPlan plan = CalculatorPlan::Compile("(1 * 2) + (1 * 2)");
+  const auto instructions = plan.GetInstructions();
+
+  using enum CalculatorOpCode;
+  EXPECT_EQ(GetOpCodes(plan), (std::vector<CalculatorOpCode>{Push, Push, Multiply, Load, Add}));
+  EXPECT_TRUE(plan.HasSharedResults());
+  EXPECT_TRUE(instructions[2].IsShared);
+  EXPECT_EQ(instructions[3].LeftOperand, 2u);
+  EXPECT_EQ(instructions[4].LeftOperand, 2u);
+  EXPECT_DOUBLE_EQ(Evaluate(plan), 4.0);
+}
+
+TEST(CalculatorPlan, Compile_LoadsLargestRepeatedSubexpression)
+{
+  // 0:1 1:2 2:+ 3:3 4:* 5:load 4 6:-, the inner (1 + 2) of the repeat is folded into the load of the whole product
+  const CalculatorPlan plan = CalculatorPlan::Compile("(1 + 2) * 3 - (1 + 2) * 3");
+  const auto instructions = plan.GetInstructions();
+
+  using enum CalculatorOpCode;
+  EXPECT_EQ(GetOpCodes(plan), (std::vector<CalculatorOpCode>{Push, Push, Add, Push, Multiply, Load, Subtract}));
+  EXPECT_FALSE(instructions[2].IsShared);
+  EXPECT_TRUE(instructions[4].IsShared);
+  EXPECT_EQ(instructions[5].LeftOperand, 4u);
+  EXPECT_DOUBLE_EQ(Evaluate(plan), 0.0);
+
+  // A repeat inside a larger expression that is not repeated
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorPlan::Compile("(2 - 1) / ((2 - 1) + (2 - 1) * 4)")), 0.2);
+}
+
+TEST(CalculatorPlan, Compile_OnlySharesIdenticalStructure)
+{
+  EXPECT_FALSE(CalculatorPlan::Compile("1 * 2 + 2 * 1").HasSharedResults());
+  EXPECT_FALSE(CalculatorPlan::Compile("2 + 2 + 2 + 2").HasSharedResults());
+  EXPECT_TRUE(CalculatorPlan::Compile("2 + 2 + (2 + 2)").HasSharedResults());
+  // Constants are compared bitwise, 0 and -0 are different operands
+  EXPECT_FALSE(CalculatorPlan::Compile("1 * -0 + 1 * 0").HasSharedResults());
+}
+
+TEST(CalculatorPlan, Compile_BindsDeclaredVariables)
+{
+  const std::string_view variables[] = {"x", "x1"};
+  const CalculatorPlan plan = CalculatorPlan::Compile("x1 * 2 + x * (x1 * 2)", variables);
+  const auto instructions = plan.GetInstructions();
+
+  using enum CalculatorOpCode;
+  EXPECT_EQ(GetOpCodes(plan), (std::vector<CalculatorOpCode>{Variable, Push, Multiply, Variable, Load, Multiply, Add}));
+  EXPECT_EQ(instructions[0].LeftOperand, 1u);
+  EXPECT_EQ(instructions[3].LeftOperand, 0u);
+  EXPECT_TRUE(instructions[2].IsShared);
+}
+
+TEST(CalculatorPlan, Compile_UndeclaredVariableThrows)
+{
+  const std::string_view variables[] = {"x"};
+  EXPECT_THROW(CalculatorPlan::Compile("y + 1", variables), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("xx + 1", variables), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("-x", variables), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("x + 1"), std::invalid_argument);
+}
+
+TEST(CalculatorPlan, Compile_MalformedExpressionThrows)
+{
+  EXPECT_THROW(CalculatorPlan::Compile(""), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("1 +"), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("(1 + 2"), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("1 2"), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("- 5"), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("1.2.3"), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("x * 2"), std::invalid_argument);
+  EXPECT_THROW(CalculatorPlan::Compile("."), std::invalid_argument);
+}
+
+TEST(CalculatorPlan, Compile_AcceptsNestingUpToMaxNestingDepth)
+{
+  const std::size_t depth = CalculatorPlan::MaxNestingDepth;
+  const std::string expression = std::string(depth, '(') + "1 + 2" + std::string(depth, ')');
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorPlan::Compile(expression)), 3.0);
+}
+
+TEST(CalculatorPlan, Compile_NestingDeeperThanMaxNestingDepthThrows)
+{
+  const std::size_t depth = CalculatorPlan::MaxNestingDepth + 1;
+  EXPECT_THROW(CalculatorPlan::Compile(std::string(depth, '(') + "1" + std::string(depth, ')')), std::invalid_argument);
+
+  // Deep enough to overflow the stack if the parser recursed for every level, the closing parentheses are not even needed
+  EXPECT_THROW(CalculatorPlan::Compile(std::string(50000, '(') + "1"), std::invalid_argument);
+}
+
+// ========================================
+// CalculatorPlanCache
+// ========================================
+
+TEST(CalculatorPlanCache, GetOrCompile_ReusesPlanForSameExpression)
+{
+  CalculatorPlanCache cache(4);
+
+  auto first = cache.GetOrCompile("1 + 2");
+  auto second = cache.GetOrCompile(std::string("1 + 2"));
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(cache.GetSize(), 1u);
+  EXPECT_EQ(cache.GetHitCount(), 1u);
+  EXPECT_EQ(cache.GetMissCount(), 1u);
+}
+
+TEST(CalculatorPlanCache, GetOrCompile_KeysOnExactText)
+{
+  CalculatorPlanCache cache(4);
+
+  auto compact = cache.GetOrCompile("1+2");
+  auto spaced = cache.GetOrCompile("1 + 2");
+
+  EXPECT_NE(compact, spaced);
+  EXPECT_EQ(cache.GetMissCount(), 2u);
+}
+
+TEST(CalculatorPlanCache, GetOrCompile_EvictsLeastRecentlyUsed)
+{
+  CalculatorPlanCache cache(2);
+
+  auto one = cache.GetOrCompile("1");
+  cache.GetOrCompile("2");
+  // Touch "1" so "2" becomes the least recently used plan
+  EXPECT_EQ(cache.GetOrCompile("1"), one);
+  cache.GetOrCompile("3");
+
+  EXPECT_EQ(cache.GetSize(), 2u);
+  EXPECT_EQ(cache.GetOrCompile("1"), one);
+  EXPECT_EQ(cache.GetHitCount(), 2u);
+
+  cache.GetOrCompile("2");
+  EXPECT_EQ(cache.GetMissCount(), 4u);
+}
+
+TEST(CalculatorPlanCache, EvictedPlanStaysValid)
+{
+  CalculatorPlanCache cache(1);
+
+  auto plan = cache.GetOrCompile("6 / 3");
+  cache.GetOrCompile("1");
+
+  EXPECT_EQ(cache.GetSize(), 1u);
+  EXPECT_DOUBLE_EQ(Evaluate(*plan), 2.0);
+}
+
+TEST(CalculatorPlanCache, MalformedExpressionIsNotCached)
+{
+  CalculatorPlanCache cache(4);
+
+  EXPECT_THROW(cache.GetOrCompile("1 +"), std::invalid_argument);
+  EXPECT_THROW(cache.GetOrCompile("1 +"), std::invalid_argument);
+
+  EXPECT_EQ(cache.GetSize(), 0u);
+  EXPECT_EQ(cache.GetMissCount(), 2u);
+}
+
+TEST(CalculatorPlanCache, ZeroCapacityCompilesEveryTime)
+{
+  CalculatorPlanCache cache(0);
+
+  auto first = cache.GetOrCompile("1 + 2");
+  auto second = cache.GetOrCompile("1 + 2");
+
+  EXPECT_NE(first, second);
+  EXPECT_EQ(cache.GetSize(), 0u);
+  EXPECT_DOUBLE_EQ(Evaluate(*second), 3.0);
+}
+
+// ========================================
+// CalculatorResultCache
+// ========================================
+
+TEST(CalculatorResultCache, TryGet_ReturnsInsertedResult)
+{
+  CalculatorResultCache cache(4);
+
+  EXPECT_FALSE(cache.TryGet("1 + 2").has_value());
+  cache.Insert("1 + 2", 3.0);
+
+  EXPECT_EQ(cache.TryGet(std::string("1 + 2")), 3.0);
+  EXPECT_FALSE(cache.TryGet("1+2").has_value());
+  EXPECT_EQ(cache.GetSize(), 1u);
+  EXPECT_EQ(cache.GetHitCount(), 1u);
+  EXPECT_EQ(cache.GetMissCount(), 2u);
+}
+
+TEST(CalculatorResultCache, Insert_ReplacesExistingResult)
+{
+  CalculatorResultCache cache(4);
+
+  cache.Insert("x", 1.0);
+  cache.Insert("x", 2.0);
+
+  EXPECT_EQ(cache.GetSize(), 1u);
+  EXPECT_EQ(cache.TryGet("x"), 2.0);
+}
+
+TEST(CalculatorResultCache, Insert_EvictsEntryNotUsedSinceLastSweep)
+{
+  CalculatorResultCache cache(3);
+  cache.Insert("1", 1.0);
+  cache.Insert("2", 2.0);
+  cache.Insert("3", 3.0);
+
+  // "1" and "3" get a second chance, "2" was not used and is replaced
+  EXPECT_TRUE(cache.TryGet("1").has_value());
+  EXPECT_TRUE(cache.TryGet("3").has_value());
+  cache.Insert("4", 4.0);
+
+  EXPECT_EQ(cache.GetSize(), 3u);
+  EXPECT_FALSE(cache.TryGet("2").has_value());
+  EXPECT_EQ(cache.TryGet("1"), 1.0);
+  EXPECT_EQ(cache.TryGet("3"), 3.0);
+  EXPECT_EQ(cache.TryGet("4"), 4.0);
+
+  // Everything was referenced again, so a full sweep clears all bits and the slot under the hand is replaced
+  cache.Insert("5", 5.0);
+  EXPECT_FALSE(cache.TryGet("3").has_value());
+  EXPECT_EQ(cache.TryGet("5"), 5.0);
+}
+
+TEST(CalculatorResultCache, ZeroCapacityCachesNothing)
+{
+  CalculatorResultCache cache(0);
+
+  cache.Insert("1 + 2", 3.0);
+
+  EXPECT_EQ(cache.GetSize(), 0u);
+  EXPECT_FALSE(cache.TryGet("1 + 2").has_value());
+}
@@ -0,0 +1,269 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include "../../../../src/Test2/Framework/Host/Managed/ManagedThreadServiceProvider.hpp"
+#include <Test2/Framework/Host/ServiceInstanceInfo.hpp>
+#include <Test2/Framework/Service/ServiceCreateInfo.hpp>
+#include <Test2/Services/Add/IAddService.hpp>
+#include <Test2/Services/Calculator/CalculatorService.hpp>
+#include <Test2/Services/Calculator/CalculatorServiceFactory.hpp>
+#include <Test2/Services/Calculator/ICalculatorService.hpp>
+#include <Test2/Services/Divide/IDivideService.hpp>
+#include <Test2/Services/Multiply/IMultiplyService.hpp>
+#include <Test2/Services/Subtract/ISubtractService.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_future.hpp>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <vector>
+#include "MockArithmeticService.hpp"
+
+using namespace Test2;
+
+namespace
+{
+  class CalculatorServiceTest : public ::testing::Test
+  {
+  protected:
+    static constexpr std::size_t ResultCacheCapacity = 16;
+
+    std::shared_ptr<ManagedThreadServiceProvider> m_provider = std::make_shared<ManagedThreadServiceProvider>();
+    std::shared_ptr<MockArithmeticService> m_arithmetic = std::make_shared<MockArithmeticService>();
+
+    void SetUp() override
+    {
+      std::vector<ServiceInstanceInfo> services;
+      services.push_back({m_arithmetic,
+                          {std::type_index(typeid(IAddService)), std::type_index(typeid(ISubtractService)),
+                           std::type_index(typeid(IMultiplyService)), std::type_index(typeid(IDivideService))}});
+      m_provider->RegisterPriorityGroup(ServiceLaunchPriority(1000), std::move(services));
+    }
+
+    double Evaluate(const CalculatorEvaluationMode mode, const std::string& expression)
+    {
+      CalculatorService calculator(ServiceCreateInfo(ServiceProvider(m_provider)), mode);
+      return Evaluate(calculator, expression);
+    }
+
+    static double Evaluate(CalculatorService& calculator, const std::string& expression)
+    {
+      return Run(calculator.EvaluateAsync(expression));
+    }
+
+    template <typename T>
+    static T Run(boost::asio::awaitable<T> work)
+    {
+      boost::asio::io_context io;
+      auto future = boost::asio::co_spawn(io, std::move(work), boost::asio::use_future);
+      io.run();
+      return future.get();
+    }
+  };
+}
+
+
+TEST_F(CalculatorServiceTest, BothModesProduceTheSameResults)
+{
+  const std::vector<std::string> expressions = {"2 + 3 * 4", "(1 + 2) * (3 + 4) / 7", "10 - 4 - 3", "-2 * (3 - -1)", "42", "(1 * 2) + (3 * 4) - (5 / 5)"};
+  for (const std::string& expression : expressions)
+  {
+    EXPECT_DOUBLE_EQ(Evaluate(CalculatorEvaluationMode::Concurrent, expression), Evaluate(CalculatorEvaluationMode::Sequential, expression))
+      << expression;
+  }
+}
+
+TEST_F(CalculatorServiceTest, Sequential_IssuesOneCallAtATime)
+{
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorEvaluationMode::Sequential, "(1 * 2) + (3 * 4)"), 14.0);
+  EXPECT_EQ(m_arithmetic->CallCount, 3);
+  EXPECT_EQ(m_arithmetic->MaxInFlight, 1);
+}
+
+TEST_F(CalculatorServiceTest, Concurrent_OverlapsIndependentOperators)
+{
+  EXPECT_DOUBLE_EQ(Evaluate(CalculatorEvaluationMode::Concurrent, "((1 * 2) + (3 * 4)) * ((5 - 1) + (6 / 2))"), 98.0);
+  EXPECT_EQ(m_arithmetic->CallCount, 7);
+  EXPECT_EQ(m_arithmetic->MaxInFlight, 4);
+}
+
+TEST_F(CalculatorServiceTest, Factory_DefaultsToSequential)
+{
+  CalculatorServiceFactory factory;
+  const auto calculator = std::dynamic_pointer_cast<CalculatorService>(
+    factory.Create(std::type_index(typeid(ICalculatorService)), ServiceCreateInfo(ServiceProvider(m_provider))));
+  ASSERT_NE(calculator, nullptr);
+
+  EXPECT_DOUBLE_EQ(Evaluate(*calculator, "(1 * 2) + (3 * 4)"), 14.0);
+  EXPECT_EQ(m_arithmetic->MaxInFlight, 1);
+}
+
+TEST_F(CalculatorServiceTest, Factory_CreatesWithSelectedMode)
+{
+  CalculatorServiceFactory factory(CalculatorEvaluationMode::Concurrent);
+  const auto calculator = std::dynamic_pointer_cast<CalculatorService>(
+    factory.Create(std::type_index(typeid(ICalculatorService)), ServiceCreateInfo(ServiceProvider(m_provider))));
+  ASSERT_NE(calculator, nullptr);
+
+  EXPECT_DOUBLE_EQ(Evaluate(*calculator, "(1 * 2) + (3 * 4)"), 14.0);
+  EXPECT_EQ(m_arithmetic->MaxInFlight, 2);
+}
+
+TEST_F(CalculatorServiceTest, Concurrent_RethrowsOperandError)
+{
+  EXPECT_THROW(Evaluate(CalculatorEvaluationMode::Concurrent, "(1 / 0) + (2 * 3)"), std::runtime_error);
+  // The multiply still ran, the join waits for both operands before reporting the error
+  EXPECT_EQ(m_arithmetic->CallCount, 1);
+}
+
+TEST_F(CalculatorServiceTest, MalformedExpressionThrows)
+{
+  EXPECT_THROW(Evaluate(CalculatorEvaluationMode::Concurrent, "(1 + 2"), std::invalid_argument);
+  EXPECT_EQ(m_arithmetic->CallCount, 0);
+}
+
+TEST_F(CalculatorServiceTest, ResultCache_RepeatedExpressionMakesNoCalls)
+{
+  CalculatorService calculator(ServiceCreateInfo(ServiceProvider(m_provider)), CalculatorEvaluationMode::Sequential, ResultCacheCapacity);
+
+  EXPECT_DOUBLE_EQ(Evaluate(calculator, "(1 + 2) * 3"), 9.0);
+  EXPECT_DOUBLE_EQ(Evaluate(calculator, "(1 + 2) * 3"), 9.0);
+
+  EXPECT_EQ(m_arithmetic->CallCount, 2);
+  EXPECT_EQ(calculator.GetResultCache().GetHitCount(), 1u);
+  EXPECT_EQ(calculator.GetResultCache().GetMissCount(), 1u);
+}
+
+TEST_F(CalculatorServiceTest, ResultCache_ZeroCapacityEvaluatesEveryTime)
+{
+  CalculatorService calculator(ServiceCreateInfo(ServiceProvider(m_provider)), CalculatorEvaluationMode::Concurrent, 0);
+
+  Evaluate(calculator, "(1 + 2) * 3");
+  Evaluate(calculator, "(1 + 2) * 3");
+
+  EXPECT_EQ(m_arithmetic->CallCount, 4);
+}
+
+TEST_F(CalculatorServiceTest, ResultCache_DisabledByDefault)
+{
+  CalculatorService calculator{ServiceCreateInfo(ServiceProvider(m_provider))};
+
+  Evaluate(calculator, "(1 + 2) * 3");
+  Evaluate(calculator, "(1 + 2) * 3");
+
+  EXPECT_EQ(m_arithmetic->CallCount, 4);
+  EXPECT_EQ(calculator.GetResultCache().GetHitCount(), 0u);
+}
+
+TEST_F(CalculatorServiceTest, ResultCache_FactoryPassesCapacity)
+{
+  CalculatorServiceFactory factory(CalculatorEvaluationMode::Sequential, ResultCacheCapacity);
+  const auto calculator = std::dynamic_pointer_cast<CalculatorService>(
+    factory.Create(std::type_index(typeid(ICalculatorService)), ServiceCreateInfo(ServiceProvider(m_provider))));
+  ASSERT_NE(calculator, nullptr);
+
+  Evaluate(*calculator, "(1 + 2) * 3");
+  Evaluate(*calculator, "(1 + 2) * 3");
+
+  EXPECT_EQ(m_arithmetic->CallCount, 2);
+  EXPECT_EQ(calculator->GetResultCache().GetHitCount(), 1u);
+}
+
+TEST_F(CalculatorServiceTest, ResultCache_ErrorsAreNotCached)
+{
+  CalculatorService calculator(ServiceCreateInfo(ServiceProvider(m_provider)), CalculatorEvaluationMode::Sequential, ResultCacheCapacity);
+
+  EXPECT_THROW(Evaluate(calculator, "1 / 0"), std::runtime_error);
+  EXPECT_THROW(Evaluate(calculator, "1 / 0"), std::runtime_error);
+
+  EXPECT_EQ(calculator.GetResultCache().GetSize(), 0u);
+}
+
+TEST_F(CalculatorServiceTest, RepeatedSubexpressionIsEvaluatedOnce)
+{
+  for (const CalculatorEvaluationMode mode : {CalculatorEvaluationMode::Sequential, CalculatorEvaluationMode::Concurrent})
+  {
+    m_arithmetic->CallCount = 0;
+    // (1 + 2) * 3 is shared, only the add, the multiply, the subtract and the divide are called
+    EXPECT_DOUBLE_EQ(Evaluate(mode, "((1 + 2) * 3 - 1) / ((1 + 2) * 3)"), 8.0 / 9.0);
+    EXPECT_EQ(m_arithmetic->CallCount, 4);
+  }
+}
+
+TEST_F(CalculatorServiceTest, Concurrent_SharedSubexpressionErrorReachesLoad)
+{
+  EXPECT_THROW(Evaluate(CalculatorEvaluationMode::Concurrent, "(1 / 0) * 2 + (1 / 0) * 3"), std::runtime_error);
+}
+
+TEST_F(CalculatorServiceTest, EvaluateManyAsync_ReturnsResultsInOrder)
+{
+  CalculatorService calculator(ServiceCreateInfo(ServiceProvider(m_provider)), CalculatorEvaluationMode::Sequential, ResultCacheCapacity);
+  const std::vector<std::string> expressions = {"1 + 2", "2 * 3", "1 + 2", "42"};
+
+  const std::vector<double> results = Run(calculator.EvaluateManyAsync(expressions));
+
+  EXPECT_EQ(results, (std::vector<double>{3.0, 6.0, 3.0, 42.0}));
+  // The repeated expression comes from the result cache
+  EXPECT_EQ(m_arithmetic->CallCount, 2);
+}
+
+TEST_F(CalculatorServiceTest, EvaluateManyAsync_MalformedExpressionThrows)
+{
+  CalculatorService calculator{ServiceCreateInfo(ServiceProvider(m_provider))};
+  const std::vector<std::string> expressions = {"1 + 2", "(1 + 2"};
+
+  EXPECT_THROW(Run(calculator.EvaluateManyAsync(expressions)), std::invalid_argument);
+}
+
+TEST_F(CalculatorServiceTest, EvaluateManyAsync_Column_OneBatchCallPerOperator)
+{
+  CalculatorService calculator{ServiceCreateInfo(ServiceProvider(m_provider))};
+  const std::vector<double> values = {0.0, 1.0, 2.0, 3.0};
+
+  const std::vector<double> results = Run(calculator.EvaluateManyAsync("(x + 1) * (x + 1) - 2", "x", values));
+
+  EXPECT_EQ(results, (std::vector<double>{-1.0, 2.0, 7.0, 14.0}));
+  // (x + 1) is shared, so only the add, the multiply and the subtract are called
+  EXPECT_EQ(m_arithmetic->BatchCallCount, 3);
+  EXPECT_EQ(m_arithmetic->CallCount, 0);
+}
+
+TEST_F(CalculatorServiceTest, EvaluateManyAsync_Column_ConstantExpressionIsBroadcast)
+{
+  CalculatorService calculator{ServiceCreateInfo(ServiceProvider(m_provider))};
+  const std::vector<double> values = {5.0, 6.0, 7.0};
+
+  EXPECT_EQ(Run(calculator.EvaluateManyAsync("1 + 2", "x", values)), (std::vector<double>{3.0, 3.0, 3.0}));
+  EXPECT_EQ(Run(calculator.EvaluateManyAsync("x", "x", values)), values);
+}
+
+TEST_F(CalculatorServiceTest, EvaluateManyAsync_Column_EmptyValuesMakeNoCalls)
+{
+  CalculatorService calculator{ServiceCreateInfo(ServiceProvider(m_provider))};
+
+  EXPECT_TRUE(Run(calculator.EvaluateManyAsync("x * 2", "x", {})).empty());
+  EXPECT_EQ(m_arithmetic->BatchCallCount, 0);
+}
+
+TEST_F(CalculatorServiceTest, EvaluateManyAsync_Column_OtherVariableThrows)
+{
+  CalculatorService calculator{ServiceCreateInfo(ServiceProvider(m_provider))};
+  const std::vector<double> values = {1.0};
+
+  EXPECT_THROW(Run(calculator.EvaluateManyAsync("y + 1", "x", values)), std::invalid_argument);
+  EXPECT_THROW(Run(calculator.EvaluateManyAsync("x + 1", "", values)), std::invalid_argument);
+}
@@ -0,0 +1,142 @@
+#ifndef TEST_SERVICES_CALCULATOR_MOCKARITHMETICSERVICE_HPP
+#define TEST_SERVICES_CALCULATOR_MOCKARITHMETICSERVICE_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Framework/Service/IServiceControl.hpp>
+#include <Test2/Framework/Service/ProcessResult.hpp>
+#include <Test2/Framework/Service/ServiceCreateInfo.hpp>
+#include <Test2/Framework/Service/ServiceInitResult.hpp>
+#include <Test2/Framework/Service/ServiceShutdownResult.hpp>
+#include <Test2/Services/Add/IAddService.hpp>
+#include <Test2/Services/BatchArithmetic.hpp>
+#include <Test2/Services/Divide/IDivideService.hpp>
+#include <Test2/Services/Multiply/IMultiplyService.hpp>
+#include <Test2/Services/Subtract/ISubtractService.hpp>
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <algorithm>
+#include <chrono>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace Test2
+{
+  /// @brief Implements all arithmetic interfaces for the calculator tests and records how the calls were made.
+  ///
+  /// Every single operation waits for the call delay on a timer, which lets calls overlap. A zero delay completes every call
+  /// without suspending, so only the calculator's own work is measured.
+  class MockArithmeticService final
+    : public IServiceControl
+    , public IAddService
+    , public ISubtractService
+    , public IMultiplyService
+    , public IDivideService
+  {
+    std::chrono::steady_clock::duration m_callDelay;
+    int m_inFlight{0};
+
+    boost::asio::awaitable<double> Complete(const double result)
+    {
+      ++m_inFlight;
+      ++CallCount;
+      MaxInFlight = std::max(MaxInFlight, m_inFlight);
+      if (m_callDelay > std::chrono::steady_clock::duration::zero())
+      {
+        const auto executor = co_await boost::asio::this_coro::executor;
+        boost::asio::steady_timer timer(executor, m_callDelay);
+        co_await timer.async_wait(boost::asio::use_awaitable);
+      }
+      --m_inFlight;
+      co_return result;
+    }
+
+  public:
+    int CallCount{0};
+    int MaxInFlight{0};
+    int BatchCallCount{0};
+
+    explicit MockArithmeticService(const std::chrono::steady_clock::duration callDelay = std::chrono::milliseconds(1))
+      : m_callDelay(callDelay)
+    {
+    }
+
+    boost::asio::awaitable<ServiceInitResult> InitAsync(const ServiceCreateInfo& /*createInfo*/) override
+    {
+      co_return ServiceInitResult::Success;
+    }
+
+    boost::asio::awaitable<ServiceShutdownResult> ShutdownAsync() override
+    {
+      co_return ServiceShutdownResult::Success;
+    }
+
+    ProcessResult Process() override
+    {
+      return ProcessResult::NoSleepLimit();
+    }
+
+    boost::asio::awaitable<double> AddAsync(const double a, const double b) override
+    {
+      return Complete(a + b);
+    }
+
+    boost::asio::awaitable<double> SubtractAsync(const double a, const double b) override
+    {
+      return Complete(a - b);
+    }
+
+    boost::asio::awaitable<double> MultiplyAsync(const double a, const double b) override
+    {
+      return Complete(a * b);
+    }
+
+    boost::asio::awaitable<double> DivideAsync(const double a, const double b) override
+    {
+      if (b == 0.0)
+      {
+        throw std::runtime_error("Division by zero");
+      }
+      return Complete(a / b);
+    }
+
+    boost::asio::awaitable<std::vector<double>> AddManyAsync(const std::span<const double> a, const std::span<const double> b) override
+    {
+      ++BatchCallCount;
+      co_return BatchArithmetic::Apply(a, b, [](const double lhs, const double rhs) { return lhs + rhs; });
+    }
+
+    boost::asio::awaitable<std::vector<double>> SubtractManyAsync(const std::span<const double> a, const std::span<const double> b) override
+    {
+      ++BatchCallCount;
+      co_return BatchArithmetic::Apply(a, b, [](const double lhs, const double rhs) { return lhs - rhs; });
+    }
+
+    boost::asio::awaitable<std::vector<double>> MultiplyManyAsync(const std::span<const double> a, const std::span<const double> b) override
+    {
+      ++BatchCallCount;
+      co_return BatchArithmetic::Apply(a, b, [](const double lhs, const double rhs) { return lhs * rhs; });
+    }
+
+    boost::asio::awaitable<std::vector<double>> DivideManyAsync(const std::span<const double> a, const std::span<const double> b) override
+    {
+      ++BatchCallCount;
+      co_return BatchArithmetic::Apply(a, b, [](const double lhs, const double rhs) { return lhs / rhs; });
+    }
+  };
+}
+
+#endif
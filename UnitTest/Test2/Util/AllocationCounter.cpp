@@ -0,0 +1,87 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include "AllocationCounter.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  thread_local std::uint64_t g_threadAllocationCount = 0;
+
+  void* CountedAllocate(const std::size_t size)
+  {
+    ++g_threadAllocationCount;
+    if (void* pointer = std::malloc(size == 0 ? 1 : size))
+    {
+      return pointer;
+    }
+    throw std::bad_alloc();
+  }
+
+  void* CountedAllocate(const std::size_t size, const std::nothrow_t& /*tag*/) noexcept
+  {
+    ++g_threadAllocationCount;
+    return std::malloc(size == 0 ? 1 : size);
+  }
+}
+
+namespace Test2
+{
+  std::uint64_t AllocationCounter::GetThreadAllocationCount() noexcept
+  {
+    return g_threadAllocationCount;
+  }
+}
+
+void* operator new(std::size_t size)
+{
+  return CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return CountedAllocate(size);
+}
+
+// The runtime allocates some of its own bookkeeping, such as thread_local destructor lists, with the nothrow variants and frees it
+// with the plain delete, so they have to come from the same heap
+void* operator new(std::size_t size, const std::nothrow_t& tag) noexcept
+{
+  return CountedAllocate(size, tag);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+  return CountedAllocate(size, tag);
+}
+
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/) noexcept
+{
+  std::free(pointer);
+}
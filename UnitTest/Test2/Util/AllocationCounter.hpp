@@ -0,0 +1,56 @@
+#ifndef TEST_ALLOCATIONCOUNTER_HPP
+#define TEST_ALLOCATIONCOUNTER_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <cstdint>
+
+namespace Test2
+{
+  /// @brief Counts heap allocations made through the global operator new on the calling thread.
+  ///
+  /// Linking AllocationCounter.cpp into a test executable replaces the global operator new/delete, so only add it to
+  /// executables that are dedicated to allocation tests.
+  ///
+  /// Usage:
+  ///   AllocationCounter counter;
+  ///   DoWork();
+  ///   EXPECT_EQ(counter.GetCount(), 0u);
+  class AllocationCounter
+  {
+    std::uint64_t m_start;
+
+  public:
+    /// @brief Starts counting from the current thread's allocation count.
+    AllocationCounter() noexcept
+      : m_start(GetThreadAllocationCount())
+    {
+    }
+
+    /// @brief Number of allocations made by this thread since construction or the last Reset().
+    [[nodiscard]] std::uint64_t GetCount() const noexcept
+    {
+      return GetThreadAllocationCount() - m_start;
+    }
+
+    void Reset() noexcept
+    {
+      m_start = GetThreadAllocationCount();
+    }
+
+    /// @brief Total number of allocations made by the calling thread.
+    static std::uint64_t GetThreadAllocationCount() noexcept;
+  };
+}
+
+#endif
@@ -0,0 +1,307 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Framework/Lifecycle/DispatchContext.hpp>
+#include <Test2/Framework/Lifecycle/ExecutorContext.hpp>
+#include <Test2/Framework/Util/AsyncProxyHelper.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detail/thread_info_base.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/use_future.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <thread>
+#include "AllocationCounter.hpp"
+
+namespace Test2
+{
+  namespace
+  {
+    constexpr int WarmUpCallCount = 16;
+    constexpr int MeasuredCallCount = 1000;
+
+    class AllocationTestService
+    {
+    public:
+      int Value{0};
+
+      int Add(const int a, const int b)
+      {
+        return a + b;
+      }
+
+      void SetValue(const int value)
+      {
+        Value = value;
+      }
+
+      boost::asio::awaitable<int> AddAsync(const int a, const int b)
+      {
+        co_return a + b;
+      }
+    };
+
+    template <typename TTag>
+    constexpr bool HasFrameCacheSize = requires { TTag::cache_size; };
+
+    /// @brief Whether asio's per-thread frame cache has the slots set by BOOST_ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE. Older Boost versions,
+    ///        such as 1.74, keep a single recycled frame per thread, so nested frames always reach the heap there.
+    constexpr bool RecyclesNestedFrames = HasFrameCacheSize<boost::asio::detail::thread_info_base::awaitable_frame_tag>;
+
+    /// @brief Allocations made on each side of a cross-thread call, per call.
+    struct CrossThreadAllocations
+    {
+      double Caller{0.0};
+      double Target{0.0};
+    };
+  }
+
+  class AsyncProxyHelperAllocationTest : public ::testing::Test
+  {
+  protected:
+    boost::asio::io_context m_ioContext;
+
+    /// @brief Runs the call repeatedly on the io_context thread and returns the allocations made by the measured calls.
+    /// @param call Returns the awaitable to measure, it is not a coroutine itself so only the awaitable's frames are counted.
+    template <typename TCall>
+    std::uint64_t CountSteadyStateAllocations(TCall call)
+    {
+      auto future = boost::asio::co_spawn(
+        m_ioContext,
+        [&call]() -> boost::asio::awaitable<std::uint64_t>
+        {
+          // The first calls fill the thread's frame recycling cache
+          for (int i = 0; i < WarmUpCallCount; ++i)
+          {
+            co_await call();
+          }
+
+          AllocationCounter counter;
+          for (int i = 0; i < MeasuredCallCount; ++i)
+          {
+            co_await call();
+          }
+          co_return counter.GetCount();
+        },
+        boost::asio::use_future);
+
+      m_ioContext.run();
+      return future.get();
+    }
+
+    /// @brief Runs the call repeatedly from the io_context thread against a target io_context on a worker thread and returns the
+    ///        average allocations per measured call on both threads.
+    /// @param call Gets the target executor and returns the awaitable to measure.
+    template <typename TCall>
+    CrossThreadAllocations CountCrossThreadAllocations(TCall call)
+    {
+      boost::asio::io_context targetIoContext;
+      auto targetWork = boost::asio::make_work_guard(targetIoContext);
+      std::thread targetThread([&targetIoContext]() { targetIoContext.run(); });
+
+      // Posted from a helper thread, so the post does not take the calling thread's recycled frame memory
+      auto getTargetAllocationCount = [&targetIoContext]()
+      {
+        std::uint64_t count = 0;
+        std::thread reader(
+          [&targetIoContext, &count]()
+          {
+            auto readCount = []() { return AllocationCounter::GetThreadAllocationCount(); };
+            count = boost::asio::post(targetIoContext, std::packaged_task<std::uint64_t()>(readCount)).get();
+          });
+        reader.join();
+        return count;
+      };
+
+      // The caller is suspended while the target runs the call, which must not let run() return
+      auto callerWork = boost::asio::make_work_guard(m_ioContext);
+      auto targetExecutor = targetIoContext.get_executor();
+      auto future = boost::asio::co_spawn(
+        m_ioContext,
+        [&call, &targetExecutor, &getTargetAllocationCount, &callerWork]() -> boost::asio::awaitable<CrossThreadAllocations>
+        {
+          for (int i = 0; i < WarmUpCallCount; ++i)
+          {
+            co_await call(targetExecutor);
+          }
+
+          // Reading the target's count blocks this thread, which is fine as nothing else runs on it
+          const std::uint64_t targetStart = getTargetAllocationCount();
+          AllocationCounter counter;
+          for (int i = 0; i < MeasuredCallCount; ++i)
+          {
+            co_await call(targetExecutor);
+          }
+          const std::uint64_t callerCount = counter.GetCount();
+          const std::uint64_t targetCount = getTargetAllocationCount() - targetStart;
+          callerWork.reset();
+          co_return CrossThreadAllocations{static_cast<double>(callerCount) / MeasuredCallCount,
+                                           static_cast<double>(targetCount) / MeasuredCallCount};
+        },
+        boost::asio::use_future);
+
+      m_ioContext.run();
+      targetWork.reset();
+      targetThread.join();
+      return future.get();
+    }
+  };
+
+  TEST_F(AsyncProxyHelperAllocationTest, AllocationCounter_CountsThreadAllocations)
+  {
+    AllocationCounter counter;
+    auto value = std::make_unique<int>(42);
+
+    EXPECT_EQ(counter.GetCount(), 1u);
+    counter.Reset();
+    EXPECT_EQ(counter.GetCount(), 0u);
+  }
+
+  TEST_F(AsyncProxyHelperAllocationTest, InvokeAsync_SameExecutorSyncMethod_SteadyStateDoesNotAllocate)
+  {
+    auto service = std::make_shared<AllocationTestService>();
+    ExecutorContext<AllocationTestService> context(service, m_ioContext.get_executor());
+
+    auto allocations = CountSteadyStateAllocations(
+      [&context]() { return Util::InvokeAsync(context, &AllocationTestService::Add, 1, 2); });
+
+    EXPECT_EQ(allocations, 0u);
+  }
+
+  TEST_F(AsyncProxyHelperAllocationTest, TryInvokeAsync_SameExecutorSyncVoidMethod_SteadyStateDoesNotAllocate)
+  {
+    auto service = std::make_shared<AllocationTestService>();
+    ExecutorContext<AllocationTestService> context(service, m_ioContext.get_executor());
+
+    auto allocations = CountSteadyStateAllocations(
+      [&context]() { return Util::TryInvokeAsync(context, &AllocationTestService::SetValue, 7); });
+
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(service->Value, 7);
+  }
+
+  TEST_F(AsyncProxyHelperAllocationTest, DispatchInvokeAsync_SameSourceAndTargetExecutor_SteadyStateDoesNotAllocate)
+  {
+    // Same setup as the CooperativeThreadHost's own proxy
+    auto sourceObj = std::make_shared<AllocationTestService>();
+    auto targetObj = std::make_shared<AllocationTestService>();
+    auto executor = m_ioContext.get_executor();
+    DispatchContext<AllocationTestService, AllocationTestService> dispatchContext(ExecutorContext<AllocationTestService>(sourceObj, executor),
+                                                                                  ExecutorContext<AllocationTestService>(targetObj, executor));
+
+    auto allocations = CountSteadyStateAllocations(
+      [&dispatchContext]() { return Util::InvokeAsync(dispatchContext, &AllocationTestService::Add, 2, 3); });
+
+    EXPECT_EQ(allocations, 0u);
+  }
+
+  TEST_F(AsyncProxyHelperAllocationTest, InvokeAsync_CrossThreadSyncMethod_SteadyStateDoesNotAllocate)
+  {
+    auto service = std::make_shared<AllocationTestService>();
+
+    auto allocations = CountCrossThreadAllocations(
+      [&service](const boost::asio::any_io_executor& targetExecutor)
+      { return Util::InvokeAsync(ExecutorContext<AllocationTestService>(service, targetExecutor), &AllocationTestService::Add, 1, 2); });
+
+    // The call and its result travel in FramePool blocks, which return to the thread that allocated them
+    EXPECT_EQ(allocations.Caller, 0.0);
+    EXPECT_EQ(allocations.Target, 0.0);
+  }
+
+  TEST_F(AsyncProxyHelperAllocationTest, TryInvokeAsync_CrossThreadDispatchContext_SteadyStateDoesNotAllocate)
+  {
+    auto sourceObj = std::make_shared<AllocationTestService>();
+    auto targetObj = std::make_shared<AllocationTestService>();
+    auto sourceExecutor = m_ioContext.get_executor();
+
+    auto allocations = CountCrossThreadAllocations(
+      [&](const boost::asio::any_io_executor& targetExecutor)
+      {
+        DispatchContext<AllocationTestService, AllocationTestService> dispatchContext(
+          ExecutorContext<AllocationTestService>(sourceObj, sourceExecutor), ExecutorContext<AllocationTestService>(targetObj, targetExecutor));
+        return Util::TryInvokeAsync(dispatchContext, &AllocationTestService::SetValue, 7);
+      });
+
+    EXPECT_EQ(allocations.Caller, 0.0);
+    EXPECT_EQ(allocations.Target, 0.0);
+    EXPECT_EQ(targetObj->Value, 7);
+  }
+
+  TEST_F(AsyncProxyHelperAllocationTest, InvokeAsync_SameExecutorAsyncMethod_SteadyStateDoesNotAllocate)
+  {
+    if constexpr (!RecyclesNestedFrames)
+    {
+      GTEST_SKIP() << "This Boost version recycles a single coroutine frame per thread";
+    }
+
+    auto service = std::make_shared<AllocationTestService>();
+    ExecutorContext<AllocationTestService> context(service, m_ioContext.get_executor());
+
+    auto allocations = CountSteadyStateAllocations(
+      [&context]() { return Util::InvokeAsync(context, &AllocationTestService::AddAsync, 1, 2); });
+
+    // The inline frame, the operation and the member function are three nested frames
+    EXPECT_EQ(allocations, 0u);
+  }
+
+  TEST_F(AsyncProxyHelperAllocationTest, TryInvokeAsync_SameExecutorAsyncMethod_SteadyStateDoesNotAllocate)
+  {
+    if constexpr (!RecyclesNestedFrames)
+    {
+      GTEST_SKIP() << "This Boost version recycles a single coroutine frame per thread";
+    }
+
+    auto service = std::make_shared<AllocationTestService>();
+    ExecutorContext<AllocationTestService> context(service, m_ioContext.get_executor());
+
+    auto allocations = CountSteadyStateAllocations(
+      [&context]() { return Util::TryInvokeAsync(context, &AllocationTestService::AddAsync, 1, 2); });
+
+    EXPECT_EQ(allocations, 0u);
+  }
+
+  TEST_F(AsyncProxyHelperAllocationTest, InvokeAsync_CrossThreadAsyncMethod_SteadyStateDoesNotAllocate)
+  {
+    auto service = std::make_shared<AllocationTestService>();
+
+    auto allocations = CountCrossThreadAllocations(
+      [&service](const boost::asio::any_io_executor& targetExecutor)
+      { return Util::InvokeAsync(ExecutorContext<AllocationTestService>(service, targetExecutor), &AllocationTestService::AddAsync, 1, 2); });
+
+    // The caller only awaits the posted call, the co_spawn and the member function's frames stay on the target
+    EXPECT_EQ(allocations.Caller, 0.0);
+    if constexpr (RecyclesNestedFrames)
+    {
+      EXPECT_EQ(allocations.Target, 0.0);
+    }
+  }
+
+  TEST_F(AsyncProxyHelperAllocationTest, TryInvokeAsync_CrossThreadAsyncMethod_SteadyStateDoesNotAllocate)
+  {
+    auto service = std::make_shared<AllocationTestService>();
+
+    auto allocations = CountCrossThreadAllocations(
+      [&service](const boost::asio::any_io_executor& targetExecutor)
+      { return Util::TryInvokeAsync(ExecutorContext<AllocationTestService>(service, targetExecutor), &AllocationTestService::AddAsync, 1, 2); });
+
+    EXPECT_EQ(allocations.Caller, 0.0);
+    if constexpr (RecyclesNestedFrames)
+    {
+      EXPECT_EQ(allocations.Target, 0.0);
+    }
+  }
+}
@@ -17,10 +17,12 @@
 #include <Test2/Framework/Util/AsyncProxyHelper.hpp>
 #include <boost/asio/co_spawn.hpp>
 #include <boost/asio/detached.hpp>
+#include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/use_future.hpp>
 #include <gtest/gtest.h>
 #include <atomic>
+#include <chrono>
 #include <future>
 #include <memory>
 #include <optional>
@@ -190,14 +192,18 @@ namespace Test2
   protected:
     boost::asio::io_context m_sourceIoContext;
     boost::asio::io_context m_targetIoContext;
+    /// @brief Keeps the target thread's run() alive until the source is done, otherwise it can return before any work is posted.
+    std::optional<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> m_targetWork;
 
     void SetUp() override
     {
       // Fresh io_contexts for each test
+      m_targetWork.emplace(m_targetIoContext.get_executor());
     }
 
     void TearDown() override
     {
+      m_targetWork.reset();
       // Stop any pending work and reset io_contexts to ensure clean state for next test
       m_sourceIoContext.stop();
       m_targetIoContext.stop();
@@ -621,6 +627,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -648,6 +655,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -674,6 +682,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -699,6 +708,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -728,6 +738,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -755,6 +766,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -785,6 +797,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -812,6 +825,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -839,6 +853,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -866,6 +881,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -913,6 +929,7 @@ namespace Test2
       });
 
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -956,6 +973,7 @@ namespace Test2
       });
 
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -999,6 +1017,7 @@ namespace Test2
       });
 
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -1043,6 +1062,7 @@ namespace Test2
       });
 
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -1097,6 +1117,7 @@ namespace Test2
 
     sourceThreadId = std::this_thread::get_id();
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert - Verify both guarantees
@@ -1143,6 +1164,7 @@ namespace Test2
 
     sourceThreadId = std::this_thread::get_id();
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert - Verify both guarantees
@@ -1164,6 +1186,96 @@ namespace Test2
   // 2. DispatchInvokeAsync_AsyncMethod_SourceThreadResumeVerification - verifies source resume
   // TryInvokeAsync and InvokeAsync share the same cross-executor dispatch implementation.
 
+  // ============================================================================
+  // Same Executor Inline Tests
+  // ============================================================================
+  // When the caller already runs on the target executor the call completes inline,
+  // so the whole caller coroutine finishes within the single handler that started it.
+
+  TEST_F(AsyncProxyHelperExecutorContextTest, InvokeAsync_SameExecutor_CompletesInline)
+  {
+    // Arrange
+    auto service = std::make_shared<TestService>();
+    auto executor = m_ioContext.get_executor();
+    ExecutorContext<TestService> context(service, executor);
+
+    // Act
+    auto future = boost::asio::co_spawn(
+      executor, [&context]() -> boost::asio::awaitable<int> { co_return co_await Util::InvokeAsync(context, &TestService::Add, 20, 22); },
+      boost::asio::use_future);
+
+    m_ioContext.poll_one();
+
+    // Assert
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_EQ(future.get(), 42);
+    EXPECT_EQ(service->CallCount.load(), 1);
+  }
+
+  TEST_F(AsyncProxyHelperExecutorContextTest, InvokeAsync_SameExecutorExpiredObject_ThrowsInline)
+  {
+    // Arrange
+    auto executor = m_ioContext.get_executor();
+    ExecutorContext<TestService> context(std::make_shared<TestService>(), executor);
+
+    // Act
+    auto future = boost::asio::co_spawn(
+      executor, [&context]() -> boost::asio::awaitable<void> { co_await Util::InvokeAsync(context, &TestService::VoidMethod); },
+      boost::asio::use_future);
+
+    m_ioContext.poll_one();
+
+    // Assert
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_THROW(future.get(), ServiceDisposedException);
+  }
+
+  TEST_F(AsyncProxyHelperExecutorContextTest, TryInvokeAsync_SameExecutorAsyncMethod_CompletesInline)
+  {
+    // Arrange
+    auto service = std::make_shared<TestService>();
+    auto executor = m_ioContext.get_executor();
+    ExecutorContext<TestService> context(service, executor);
+
+    // Act
+    auto future = boost::asio::co_spawn(
+      executor,
+      [&context]() -> boost::asio::awaitable<std::optional<int>> { co_return co_await Util::TryInvokeAsync(context, &TestService::AddAsync, 1, 2); },
+      boost::asio::use_future);
+
+    m_ioContext.poll_one();
+
+    // Assert
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_EQ(future.get(), std::optional<int>(3));
+  }
+
+  TEST_F(AsyncProxyHelperDispatchContextTest, DispatchInvokeAsync_SameSourceAndTargetExecutor_CompletesInline)
+  {
+    // Arrange - like the CooperativeThreadHost's own proxy, source and target share one executor
+    auto sourceObj = std::make_shared<TestService>();
+    auto targetObj = std::make_shared<TestService>();
+    auto executor = m_sourceIoContext.get_executor();
+
+    ExecutorContext<TestService> sourceContext(sourceObj, executor);
+    ExecutorContext<TestService> targetContext(targetObj, executor);
+    DispatchContext<TestService, TestService> dispatchContext(sourceContext, targetContext);
+
+    // Act
+    auto future = boost::asio::co_spawn(
+      executor,
+      [&dispatchContext]() -> boost::asio::awaitable<std::thread::id>
+      { co_return co_await Util::InvokeAsync(dispatchContext, &TestService::GetThreadId); },
+      boost::asio::use_future);
+
+    m_sourceIoContext.poll_one();
+
+    // Assert
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_EQ(future.get(), std::this_thread::get_id());
+    EXPECT_EQ(targetObj->CallCount.load(), 1);
+  }
+
   // ============================================================================
   // Async Result Propagation Tests
   // ============================================================================
@@ -1227,6 +1339,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert - Result should propagate from target to source correctly through entire async chain
@@ -1253,6 +1366,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -1366,6 +1480,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -1390,6 +1505,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -1415,6 +1531,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -1448,6 +1565,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert - Should complete successfully since lock was held during execution
@@ -1541,6 +1659,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -1565,6 +1684,7 @@ namespace Test2
 
     std::thread targetThread([this]() { m_targetIoContext.run(); });
     m_sourceIoContext.run();
+    m_targetWork.reset();
     targetThread.join();
 
     // Assert
@@ -0,0 +1,137 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Framework/Util/AsyncSignal.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/use_future.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+namespace Test2
+{
+  class AsyncSignalTest : public ::testing::Test
+  {
+  protected:
+    boost::asio::io_context m_ioContext;
+
+    /// @brief Polls the io_context until the future is ready, like a cooperative main loop would.
+    template <typename T>
+    void PollUntilReady(std::future<T>& future)
+    {
+      while (future.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready)
+      {
+        m_ioContext.poll();
+        m_ioContext.restart();
+      }
+    }
+  };
+
+  TEST_F(AsyncSignalTest, Set_BeforeWait_WaitCompletesImmediately)
+  {
+    Util::AsyncSignal signal(m_ioContext.get_executor());
+    EXPECT_TRUE(signal.Set());
+    EXPECT_TRUE(signal.IsSet());
+
+    auto future =
+      boost::asio::co_spawn(m_ioContext, [signal]() mutable -> boost::asio::awaitable<void> { co_await signal.WaitAsync(); }, boost::asio::use_future);
+
+    m_ioContext.run();
+
+    EXPECT_NO_THROW(future.get());
+  }
+
+  TEST_F(AsyncSignalTest, Set_CalledTwice_SecondCallReturnsFalse)
+  {
+    Util::AsyncSignal signal(m_ioContext.get_executor());
+
+    EXPECT_TRUE(signal.Set());
+    EXPECT_FALSE(signal.Set());
+    EXPECT_FALSE(signal.SetException(std::make_exception_ptr(std::runtime_error("ignored"))));
+  }
+
+  TEST_F(AsyncSignalTest, Set_FromOtherThread_WaiterResumesOnExecutorThread)
+  {
+    Util::AsyncSignal signal(m_ioContext.get_executor());
+    std::thread::id resumedOn;
+
+    auto future = boost::asio::co_spawn(
+      m_ioContext,
+      [signal, &resumedOn]() mutable -> boost::asio::awaitable<void>
+      {
+        co_await signal.WaitAsync();
+        resumedOn = std::this_thread::get_id();
+      },
+      boost::asio::use_future);
+
+    std::thread setter(
+      [signal]() mutable
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        signal.Set();
+      });
+
+    PollUntilReady(future);
+    setter.join();
+
+    EXPECT_NO_THROW(future.get());
+    EXPECT_EQ(resumedOn, std::this_thread::get_id());
+  }
+
+  TEST_F(AsyncSignalTest, WaitAsync_WhileWaiting_ExecutorKeepsRunningOtherWork)
+  {
+    Util::AsyncSignal signal(m_ioContext.get_executor());
+    std::atomic<int> otherWorkCount{0};
+
+    auto future =
+      boost::asio::co_spawn(m_ioContext, [signal]() mutable -> boost::asio::awaitable<void> { co_await signal.WaitAsync(); }, boost::asio::use_future);
+
+    // Give the waiter a chance to start waiting, then run unrelated work on the same executor
+    m_ioContext.poll();
+    m_ioContext.restart();
+    for (int i = 0; i < 3; ++i)
+    {
+      boost::asio::post(m_ioContext, [&otherWorkCount]() { ++otherWorkCount; });
+    }
+    m_ioContext.poll();
+    m_ioContext.restart();
+
+    EXPECT_EQ(otherWorkCount.load(), 3);
+    EXPECT_NE(future.wait_for(std::chrono::milliseconds(0)), std::future_status::ready);
+
+    signal.Set();
+    PollUntilReady(future);
+
+    EXPECT_NO_THROW(future.get());
+  }
+
+  TEST_F(AsyncSignalTest, SetException_WaitAsyncRethrows)
+  {
+    Util::AsyncSignal signal(m_ioContext.get_executor());
+
+    auto future =
+      boost::asio::co_spawn(m_ioContext, [signal]() mutable -> boost::asio::awaitable<void> { co_await signal.WaitAsync(); }, boost::asio::use_future);
+
+    std::thread setter([signal]() mutable { signal.SetException(std::make_exception_ptr(std::runtime_error("start failed"))); });
+
+    PollUntilReady(future);
+    setter.join();
+
+    EXPECT_THROW(future.get(), std::runtime_error);
+  }
+}
@@ -0,0 +1,130 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Framework/Util/AsyncWhenAll.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/use_future.hpp>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Test2
+{
+  namespace
+  {
+    boost::asio::awaitable<void> RecordAfterDelayAsync(std::vector<int>& completionOrder, const int id, const std::chrono::milliseconds delay)
+    {
+      boost::asio::steady_timer timer(co_await boost::asio::this_coro::executor, delay);
+      co_await timer.async_wait(boost::asio::use_awaitable);
+      completionOrder.push_back(id);
+    }
+
+    boost::asio::awaitable<void> ThrowAfterYieldAsync(const std::string message)
+    {
+      co_await boost::asio::post(co_await boost::asio::this_coro::executor, boost::asio::use_awaitable);
+      throw std::runtime_error(message);
+    }
+  }
+
+  class AsyncWhenAllTest : public ::testing::Test
+  {
+  protected:
+    boost::asio::io_context m_ioContext;
+  };
+
+  TEST_F(AsyncWhenAllTest, WhenAllAsync_NoTasks_ReturnsEmpty)
+  {
+    auto future = boost::asio::co_spawn(m_ioContext, Util::WhenAllAsync({}), boost::asio::use_future);
+
+    m_ioContext.run();
+
+    EXPECT_TRUE(future.get().empty());
+  }
+
+  TEST_F(AsyncWhenAllTest, WhenAllAsync_AllSucceed_ReturnsNullPerTask)
+  {
+    std::vector<int> completionOrder;
+    std::vector<boost::asio::awaitable<void>> tasks;
+    tasks.push_back(RecordAfterDelayAsync(completionOrder, 1, std::chrono::milliseconds(0)));
+    tasks.push_back(RecordAfterDelayAsync(completionOrder, 2, std::chrono::milliseconds(0)));
+
+    auto future = boost::asio::co_spawn(m_ioContext, Util::WhenAllAsync(std::move(tasks)), boost::asio::use_future);
+
+    m_ioContext.run();
+
+    auto results = future.get();
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_FALSE(results[0]);
+    EXPECT_FALSE(results[1]);
+    EXPECT_EQ(completionOrder.size(), 2u);
+  }
+
+  TEST_F(AsyncWhenAllTest, WhenAllAsync_TasksOverlap_CompletesAfterSlowestTask)
+  {
+    std::vector<int> completionOrder;
+    std::vector<boost::asio::awaitable<void>> tasks;
+    tasks.push_back(RecordAfterDelayAsync(completionOrder, 1, std::chrono::milliseconds(100)));
+    tasks.push_back(RecordAfterDelayAsync(completionOrder, 2, std::chrono::milliseconds(100)));
+    tasks.push_back(RecordAfterDelayAsync(completionOrder, 3, std::chrono::milliseconds(10)));
+
+    const auto startTime = std::chrono::steady_clock::now();
+    auto future = boost::asio::co_spawn(m_ioContext, Util::WhenAllAsync(std::move(tasks)), boost::asio::use_future);
+
+    m_ioContext.run();
+    const auto elapsed = std::chrono::steady_clock::now() - startTime;
+
+    future.get();
+    ASSERT_EQ(completionOrder.size(), 3u);
+    // The short task finished first even though it was queued last
+    EXPECT_EQ(completionOrder[0], 3);
+    // Running one after another would take at least 210ms
+    EXPECT_LT(elapsed, std::chrono::milliseconds(200));
+  }
+
+  TEST_F(AsyncWhenAllTest, WhenAllAsync_SomeFail_ReportsErrorsInTaskOrderAndWaitsForAll)
+  {
+    std::vector<int> completionOrder;
+    std::vector<boost::asio::awaitable<void>> tasks;
+    tasks.push_back(ThrowAfterYieldAsync("first"));
+    tasks.push_back(RecordAfterDelayAsync(completionOrder, 1, std::chrono::milliseconds(20)));
+    tasks.push_back(ThrowAfterYieldAsync("third"));
+
+    auto future = boost::asio::co_spawn(m_ioContext, Util::WhenAllAsync(std::move(tasks)), boost::asio::use_future);
+
+    m_ioContext.run();
+
+    auto results = future.get();
+    ASSERT_EQ(results.size(), 3u);
+    ASSERT_TRUE(results[0]);
+    EXPECT_FALSE(results[1]);
+    ASSERT_TRUE(results[2]);
+    // The failures did not cut the successful task short
+    EXPECT_EQ(completionOrder.size(), 1u);
+
+    try
+    {
+      std::rethrow_exception(results[2]);
+    }
+    catch (const std::runtime_error& ex)
+    {
+      EXPECT_EQ(std::string(ex.what()), "third");
+    }
+  }
+}
@@ -0,0 +1,90 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Framework/Util/FramePool.hpp>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include "AllocationCounter.hpp"
+
+namespace Test2
+{
+  using Util::FramePool;
+
+  TEST(FramePoolTest, Allocate_AfterDeallocateOnSameThread_ReusesBlock)
+  {
+    void* pFirst = FramePool::Allocate(100);
+    FramePool::Deallocate(pFirst, 100);
+
+    AllocationCounter counter;
+    void* pSecond = FramePool::Allocate(100);
+
+    EXPECT_EQ(pSecond, pFirst);
+    EXPECT_EQ(counter.GetCount(), 0u);
+    FramePool::Deallocate(pSecond, 100);
+  }
+
+  TEST(FramePoolTest, Allocate_SmallerSizeOfSameBlockSize_ReusesBlock)
+  {
+    void* pFirst = FramePool::Allocate(FramePool::SmallestBlockSize * 2);
+    FramePool::Deallocate(pFirst, FramePool::SmallestBlockSize * 2);
+
+    void* pSecond = FramePool::Allocate(FramePool::SmallestBlockSize + 1);
+
+    EXPECT_EQ(pSecond, pFirst);
+    FramePool::Deallocate(pSecond, FramePool::SmallestBlockSize + 1);
+  }
+
+  TEST(FramePoolTest, Deallocate_OnAnotherThread_ReturnsBlockToOwner)
+  {
+    void* pFirst = FramePool::Allocate(200);
+    std::thread([pFirst]() { FramePool::Deallocate(pFirst, 200); }).join();
+
+    AllocationCounter counter;
+    void* pSecond = FramePool::Allocate(200);
+
+    EXPECT_EQ(pSecond, pFirst);
+    EXPECT_EQ(counter.GetCount(), 0u);
+    FramePool::Deallocate(pSecond, 200);
+  }
+
+  TEST(FramePoolTest, Allocate_LargerThanLargestBlock_UsesHeap)
+  {
+    constexpr std::size_t Size = FramePool::LargestBlockSize + 1;
+    FramePool::Deallocate(FramePool::Allocate(Size), Size);
+
+    AllocationCounter counter;
+    void* pMemory = FramePool::Allocate(Size);
+
+    EXPECT_EQ(counter.GetCount(), 1u);
+    FramePool::Deallocate(pMemory, Size);
+  }
+
+  TEST(FramePoolTest, Deallocate_AfterOwnerThreadExited_ReturnsBlockToHeap)
+  {
+    void* pMemory = nullptr;
+    std::thread([&pMemory]() { pMemory = FramePool::Allocate(100); }).join();
+
+    // The pool outlived its thread for this block, freeing it releases the pool as well
+    FramePool::Deallocate(pMemory, 100);
+  }
+
+  TEST(FramePoolTest, Allocate_KeepsDefaultNewAlignment)
+  {
+    void* pMemory = FramePool::Allocate(24);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pMemory) % alignof(std::max_align_t), 0u);
+    FramePool::Deallocate(pMemory, 24);
+  }
+}
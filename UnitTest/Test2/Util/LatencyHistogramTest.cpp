@@ -0,0 +1,135 @@
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Framework/Util/LatencyHistogram.hpp>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+
+using namespace Test2::Util;
+using namespace std::chrono_literals;
+
+TEST(LatencyHistogram, Empty_ReportsZero)
+{
+  const LatencyHistogram histogram;
+
+  EXPECT_EQ(histogram.GetCount(), 0u);
+  EXPECT_EQ(histogram.GetMax(), 0ns);
+  EXPECT_EQ(histogram.GetPercentile(50.0), 0ns);
+  EXPECT_EQ(histogram.GetPercentile(99.0), 0ns);
+}
+
+TEST(LatencyHistogram, SmallValues_AreExact)
+{
+  LatencyHistogram histogram;
+  for (std::int64_t value = 1; value <= 20; ++value)
+  {
+    histogram.Record(std::chrono::nanoseconds(value));
+  }
+
+  // Everything below 32ns has a bucket of its own
+  EXPECT_EQ(histogram.GetCount(), 20u);
+  EXPECT_EQ(histogram.GetPercentile(50.0), 10ns);
+  EXPECT_EQ(histogram.GetPercentile(95.0), 19ns);
+  EXPECT_EQ(histogram.GetPercentile(100.0), 20ns);
+  EXPECT_EQ(histogram.GetMax(), 20ns);
+}
+
+TEST(LatencyHistogram, LargeValues_StayWithinBucketPrecision)
+{
+  LatencyHistogram histogram;
+  for (std::int64_t value = 1; value <= 1000; ++value)
+  {
+    histogram.Record(std::chrono::microseconds(value));
+  }
+
+  const auto p50 = histogram.GetPercentile(50.0);
+  const auto p99 = histogram.GetPercentile(99.0);
+  // Never below the exact answer and less than one bucket width (1/16) above it
+  EXPECT_GE(p50, 500us);
+  EXPECT_LT(p50, 500us + 500us / 16);
+  EXPECT_GE(p99, 990us);
+  EXPECT_LT(p99, 990us + 990us / 16);
+  EXPECT_EQ(histogram.GetMax(), 1000us);
+}
+
+TEST(LatencyHistogram, Percentile_IsCappedToMax)
+{
+  LatencyHistogram histogram;
+  histogram.Record(1000ns);
+
+  EXPECT_EQ(histogram.GetPercentile(50.0), 1000ns);
+  EXPECT_EQ(histogram.GetPercentile(100.0), 1000ns);
+}
+
+TEST(LatencyHistogram, Percentile_OutOfRangeIsClamped)
+{
+  LatencyHistogram histogram;
+  histogram.Record(5ns);
+  histogram.Record(7ns);
+
+  EXPECT_EQ(histogram.GetPercentile(-10.0), 5ns);
+  EXPECT_EQ(histogram.GetPercentile(0.0), 5ns);
+  EXPECT_EQ(histogram.GetPercentile(250.0), 7ns);
+}
+
+TEST(LatencyHistogram, SingleOutlier_OnlyAffectsHighPercentiles)
+{
+  LatencyHistogram histogram;
+  for (int i = 0; i < 999; ++i)
+  {
+    histogram.Record(10ns);
+  }
+  histogram.Record(5ms);
+
+  EXPECT_EQ(histogram.GetPercentile(50.0), 10ns);
+  EXPECT_EQ(histogram.GetPercentile(99.0), 10ns);
+  EXPECT_EQ(histogram.GetPercentile(100.0), 5ms);
+  EXPECT_EQ(histogram.GetMax(), 5ms);
+}
+
+TEST(LatencyHistogram, NegativeDuration_CountsAsZero)
+{
+  LatencyHistogram histogram;
+  histogram.Record(-5ns);
+
+  EXPECT_EQ(histogram.GetCount(), 1u);
+  EXPECT_EQ(histogram.GetMax(), 0ns);
+  EXPECT_EQ(histogram.GetPercentile(50.0), 0ns);
+}
+
+TEST(LatencyHistogram, BeyondMaxTrackable_KeepsExactMax)
+{
+  LatencyHistogram histogram;
+  histogram.Record(1ns);
+  histogram.Record(10min);
+
+  EXPECT_EQ(histogram.GetCount(), 2u);
+  EXPECT_EQ(histogram.GetMax(), 10min);
+  EXPECT_EQ(histogram.GetPercentile(100.0), std::chrono::nanoseconds(LatencyHistogram::MaxTrackable));
+}
+
+TEST(LatencyHistogram, Reset_ClearsEverything)
+{
+  LatencyHistogram histogram;
+  histogram.Record(3us);
+  histogram.Record(4us);
+  histogram.Reset();
+
+  EXPECT_EQ(histogram.GetCount(), 0u);
+  EXPECT_EQ(histogram.GetMax(), 0ns);
+  EXPECT_EQ(histogram.GetPercentile(50.0), 0ns);
+
+  histogram.Record(2ns);
+  EXPECT_EQ(histogram.GetPercentile(50.0), 2ns);
+}
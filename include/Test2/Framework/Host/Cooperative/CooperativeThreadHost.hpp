@@ -13,10 +13,12 @@
 //* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 //****************************************************************************************************************************************************
 
+#include <Test2/Framework/Host/ServiceProcessTiming.hpp>
 #include <Test2/Framework/Lifecycle/ExecutorContext.hpp>
 #include <Test2/Framework/Lifecycle/ILifeTracker.hpp>
 #include <boost/asio/cancellation_signal.hpp>
 #include <memory>
+#include <vector>
 
 namespace Test2
 {
@@ -67,6 +69,22 @@ namespace Test2
     ///
     /// @return The number of handlers that were executed.
     std::size_t Poll();
+
+    /// @brief Blocks until work is posted to the main thread or the sleep limit of the given result expires.
+    ///
+    /// @param processResult The sleep hint, normally the value returned by the last Update().
+    /// @return The number of handlers that were executed.
+    std::size_t WaitForWork(const ProcessResult& processResult);
+
+    /// @brief Enables or disables measuring the duration of every service Process() call, disabled by default.
+    ///
+    /// Disabling it discards the recorded timings.
+    void SetProcessTimingEnabled(const bool enabled);
+
+    /// @brief Gets the Process() call count and p50/p99/max durations of every processed service.
+    ///
+    /// @return The per-service timings in registration order, empty while timing is disabled.
+    std::vector<ServiceProcessTiming> GetProcessTimings() const;
   };
 }
 
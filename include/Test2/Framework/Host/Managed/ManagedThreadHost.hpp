@@ -15,10 +15,15 @@
 
 #include <Test2/Framework/Host/IThreadSafeServiceHost.hpp>
 #include <Test2/Framework/Host/Managed/ManagedThreadRecord.hpp>
+#include <Test2/Framework/Host/Managed/ManagedThreadRunMode.hpp>
+#include <Test2/Framework/Host/ServiceProcessTiming.hpp>
 #include <Test2/Framework/Lifecycle/ExecutorContext.hpp>
 #include <Test2/Framework/Lifecycle/ILifeTracker.hpp>
+#include <Test2/Framework/Util/AsyncSignal.hpp>
 #include <memory>
+#include <span>
 #include <thread>
+#include <vector>
 
 namespace Test2
 {
@@ -29,11 +34,18 @@ namespace Test2
   class ManagedThreadHost
   {
     ExecutorContext<ILifeTracker> m_sourceContext;
+    ManagedThreadRunMode m_runMode;
     std::shared_ptr<ServiceHostProxy> m_serviceHostProxy;
     std::thread m_thread;
+    /// @brief Set by the thread once it has constructed its service host, waiters resume on the source executor.
+    Util::AsyncSignal m_startedSignal;
+    /// @brief Set by the thread when it exits, waiters resume on the source executor.
+    Util::AsyncSignal m_exitedSignal;
 
   public:
-    ManagedThreadHost(ExecutorContext<ILifeTracker> sourceContext);
+    /// @param sourceContext The context that owns the host, start and exit waits resume on its executor.
+    /// @param runMode How the managed thread drives its event loop.
+    explicit ManagedThreadHost(ExecutorContext<ILifeTracker> sourceContext, const ManagedThreadRunMode runMode = ManagedThreadRunMode::EventLoop);
     ~ManagedThreadHost();
     ManagedThreadHost(const ManagedThreadHost&) = delete;
     ManagedThreadHost& operator=(const ManagedThreadHost&) = delete;
@@ -50,9 +62,44 @@ namespace Test2
     /// @param cancel_slot Cancellation slot to stop the thread.
     /// @return An awaitable that completes when the thread has started, containing a ManagedThreadRecord with the lifetime awaitable.
     boost::asio::awaitable<ManagedThreadRecord> StartAsync();
+
+    /// @brief Starts several managed threads at once.
+    ///
+    /// All threads are launched before waiting for any of them to become ready, so bringing up N threads costs roughly one
+    /// thread start instead of N. Like StartAsync, the wait does not block the calling executor.
+    /// @param hosts The hosts to start, none of them may have been started before.
+    /// @return One ManagedThreadRecord per host, in the same order as the input.
+    static boost::asio::awaitable<std::vector<ManagedThreadRecord>> StartAllAsync(std::span<ManagedThreadHost* const> hosts);
+
+    /// @brief Requests the managed thread to shut down and waits for it to exit.
+    ///
+    /// The wait for the thread to exit is asynchronous, so the calling executor keeps running while the thread winds down.
+    /// @return false if the thread was not running, otherwise the result of the shutdown request.
+    /// @throws The exception that terminated the managed thread, if any (the thread has been joined at that point).
     boost::asio::awaitable<bool> TryShutdownAsync();
 
     std::shared_ptr<IThreadSafeServiceHost> GetServiceHost();
+
+    /// @brief Enables or disables measuring the duration of every service Process() call on the managed thread, disabled by default.
+    ///
+    /// Only ManagedThreadRunMode::ProcessTick calls Process(), in EventLoop mode there is nothing to measure. Disabling it discards the
+    /// recorded timings.
+    /// @throws std::runtime_error if the thread has not been started.
+    boost::asio::awaitable<void> SetProcessTimingEnabledAsync(const bool enabled);
+
+    /// @brief Gets the Process() call count and p50/p99/max durations of every processed service from the managed thread.
+    ///
+    /// The snapshot is taken on the managed thread, the calling executor keeps running while it waits for it.
+    /// @return The per-service timings in registration order, empty while timing is disabled.
+    /// @throws std::runtime_error if the thread has not been started.
+    boost::asio::awaitable<std::vector<ServiceProcessTiming>> GetProcessTimingsAsync();
+
+  private:
+    /// @brief Creates the thread without waiting for it to construct its service host.
+    void LaunchThread();
+
+    /// @brief Waits for a launched thread to finish constructing its service host without blocking the calling executor.
+    boost::asio::awaitable<ManagedThreadRecord> CompleteStartAsync();
   };
 }
 
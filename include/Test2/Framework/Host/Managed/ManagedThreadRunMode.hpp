@@ -0,0 +1,32 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_HOST_MANAGED_MANAGEDTHREADRUNMODE_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_HOST_MANAGED_MANAGEDTHREADRUNMODE_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+namespace Test2
+{
+  /// @brief Controls how a managed thread drives its io_context.
+  enum class ManagedThreadRunMode
+  {
+    /// @brief Only run io_context handlers, IServiceControl::Process() is never called.
+    EventLoop = 0,
+
+    /// @brief Interleave io_context handlers with IServiceControl::Process() calls.
+    ///        The merged ProcessResult decides how long the thread may sleep: SleepLimit wakes up after the duration,
+    ///        NoSleepLimit sleeps until work is posted and Quit stops calling Process() (handlers keep running until shutdown).
+    ///        Posted work always wakes the thread immediately.
+    ProcessTick = 1
+  };
+}
+
+#endif
@@ -14,6 +14,7 @@
 //****************************************************************************************************************************************************
 
 #include <Test2/Framework/Host/IThreadSafeServiceHost.hpp>
+#include <Test2/Framework/Host/ServiceProcessTiming.hpp>
 #include <Test2/Framework/Host/StartServiceRecord.hpp>
 #include <Test2/Framework/Lifecycle/DispatchContext.hpp>
 #include <Test2/Framework/Lifecycle/ILifeTracker.hpp>
@@ -35,7 +36,8 @@ namespace Test2
   ///
   /// This proxy can be safely used from any thread to invoke operations on a
   /// service host that lives on a different thread. All operations are marshalled
-  /// to the target executor using co_spawn.
+  /// to the target executor through AsyncProxyHelper. The methods return the helper's awaitable as is, so a call
+  /// costs no coroutine frame of its own and the call and its result travel in FramePool memory.
   class ServiceHostProxy final : public IThreadSafeServiceHost
   {
     ///! Dispatch context containing source and target executor contexts.
@@ -76,6 +78,15 @@ namespace Test2
     //! @note This is safe to call from any thread, including destructors.
     //! @note This method is noexcept and will not throw exceptions.
     bool TryRequestShutdown() noexcept;
+
+    //! @brief Enables or disables Process() timing on the service host's executor.
+    //! @throws ServiceDisposedException if the service host has been destroyed.
+    boost::asio::awaitable<void> SetProcessTimingEnabledAsync(const bool enabled);
+
+    //! @brief Fetches a snapshot of the Process() timings from the service host's executor.
+    //! @return The per-service timings in registration order, empty while timing is disabled.
+    //! @throws ServiceDisposedException if the service host has been destroyed.
+    boost::asio::awaitable<std::vector<ServiceProcessTiming>> GetProcessTimingsAsync();
   };
 }
 
@@ -14,6 +14,7 @@
 //****************************************************************************************************************************************************
 
 #include <Test2/Framework/Service/IServiceControl.hpp>
+#include <Test2/Framework/Service/ServiceIdBinding.hpp>
 #include <memory>
 #include <typeindex>
 #include <vector>
@@ -23,11 +24,13 @@ namespace Test2
   /// @brief Information about a registered service instance.
   ///
   /// Stores the service control interface and the list of service interfaces
-  /// that this instance supports for type-based lookup.
+  /// that this instance supports for type-based lookup, plus the optional ServiceId
+  /// bindings used by the id based lookup.
   struct ServiceInstanceInfo
   {
     std::shared_ptr<IServiceControl> Service;
     std::vector<std::type_index> SupportedInterfaces;
+    std::vector<ServiceIdBinding> SupportedServiceIds{};
   };
 }
 
@@ -0,0 +1,34 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_HOST_SERVICEPROCESSTIMING_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_HOST_SERVICEPROCESSTIMING_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <chrono>
+#include <cstdint>
+#include <typeindex>
+
+namespace Test2
+{
+  /// @brief Snapshot of the measured Process() durations of one hosted service, returned by the process timing queries of the hosts.
+  struct ServiceProcessTiming
+  {
+    /// @brief The dynamic type of the service.
+    std::type_index ServiceType;
+    std::uint64_t CallCount{0};
+    std::chrono::nanoseconds P50{0};
+    std::chrono::nanoseconds P99{0};
+    std::chrono::nanoseconds Max{0};
+  };
+}
+
+#endif
@@ -19,11 +19,14 @@
 #include <Test2/Framework/Host/Managed/ManagedThreadHost.hpp>
 #include <Test2/Framework/Host/StartServiceRecord.hpp>
 #include <Test2/Framework/Lifecycle/LifecycleManagerConfig.hpp>
+#include <Test2/Framework/Lifecycle/ServiceStartupMode.hpp>
 #include <Test2/Framework/Registry/ServiceRegistrationRecord.hpp>
 #include <Test2/Framework/Registry/ServiceThreadGroupId.hpp>
 #include <Test2/Framework/Service/ProcessResult.hpp>
 #include <Test2/Framework/Service/ServiceShutdownResult.hpp>
+#include <Test2/Framework/Util/AsyncWhenAll.hpp>
 #include <boost/asio/awaitable.hpp>
+#include <spdlog/spdlog.h>
 #include <map>
 #include <memory>
 #include <set>
@@ -51,7 +54,7 @@ namespace Test2
   /// Usage:
   /// 1. Create LifecycleManager with config and service registrations
   /// 2. Call StartServicesAsync() to start all services
-  /// 3. Call Update() or Poll() from main loop for cooperative services
+  /// 3. Call Update() or Poll() from main loop for cooperative services, WaitForWork() lets an idle loop sleep in between
   /// 4. Call ShutdownServicesAsync() to cleanly shut down
   class LifecycleManager
   {
@@ -108,7 +111,8 @@ namespace Test2
     /// @brief Starts all registered services in priority order (highest first).
     ///
     /// First ensures all required thread hosts are started, then starts services.
-    /// Services are grouped by thread group and started in parallel within each priority level.
+    /// Services are grouped by thread group within each priority level. Depending on LifecycleManagerConfig::StartupMode the
+    /// thread groups of a level are started one after another or all at once, but a level always finishes before the next begins.
     /// On failure, all successfully started services are rolled back in reverse priority order,
     /// and an AggregateException is thrown containing all errors.
     ///
@@ -121,7 +125,8 @@ namespace Test2
         co_return;
       }
 
-      co_await DoStartServicesAsync(m_registrations, m_startedPriorities, m_mainHost, m_threadHosts, m_stopSource.get_token());
+      co_await DoStartServicesAsync(m_registrations, m_startedPriorities, m_mainHost, m_threadHosts, m_config,
+                                    m_stopSource.get_token());
     }
 
     /// @brief Shuts down all started services in reverse priority order.
@@ -161,6 +166,17 @@ namespace Test2
       return m_mainHost.Poll();
     }
 
+    /// @brief Blocks the main thread until work is posted to it or the sleep limit expires.
+    ///
+    /// A typical main loop is `while (running) { manager.WaitForWork(manager.Update()); }`.
+    ///
+    /// @param processResult The sleep hint, normally the value returned by the last Update().
+    /// @return The number of handlers that were executed.
+    std::size_t WaitForWork(const ProcessResult& processResult)
+    {
+      return m_mainHost.WaitForWork(processResult);
+    }
+
     /// @brief Gets the main thread's cooperative host.
     ///
     /// Use this to access the service host via GetServiceHost().
@@ -206,11 +222,13 @@ namespace Test2
     /// @param startedPriorities Output vector to track successfully started priority levels.
     /// @param mainHost Reference to the main cooperative thread host.
     /// @param threadHosts Map of managed thread hosts (will be populated as needed).
+    /// @param config Controls how the thread groups within each priority level are started and how the managed threads run.
     /// @param stopToken Stop token to indicate if the LifecycleManager object has died.
     /// @throws AggregateException if any service fails to start (after rollback).
     static boost::asio::awaitable<void> DoStartServicesAsync(std::vector<ServiceRegistrationRecord>& registrations,
                                                              std::vector<StartedPriorityRecord>& startedPriorities, CooperativeThreadHost& mainHost,
-                                                             ThreadGroupHostsMap& threadHosts, std::stop_token stopToken)
+                                                             ThreadGroupHostsMap& threadHosts, const LifecycleManagerConfig& config,
+                                                             std::stop_token stopToken)
     {
       // Group registrations by priority, then by thread group
       // Outer map: priority (highest first via std::greater)
@@ -226,17 +244,24 @@ namespace Test2
       // First pass: Start all required thread hosts before starting any services
       auto requiredThreadGroups = CollectRequiredThreadGroups(priorityGroups);
 
+      std::vector<ManagedThreadHost*> hostsToStart;
+      hostsToStart.reserve(requiredThreadGroups.size());
       for (const auto& threadGroupId : requiredThreadGroups)
       {
-        auto host = std::make_unique<ManagedThreadHost>(mainHost.GetExecutorContext());
-        // Start the thread (it will run io_context.run())
-        co_await host->StartAsync();
+        auto host = std::make_unique<ManagedThreadHost>(mainHost.GetExecutorContext(), config.ThreadRunMode);
+        hostsToStart.push_back(host.get());
         threadHosts.emplace(threadGroupId, std::move(host));
       }
 
+      // Start all the threads together (each will run io_context.run())
+      co_await ManagedThreadHost::StartAllAsync(hostsToStart);
+
       // Second pass: Start services in priority order (highest first due to std::greater comparator)
       for (auto& [priority, threadGroups] : priorityGroups)
       {
+        std::vector<ServiceThreadGroupId> threadGroupIds;
+        std::vector<boost::asio::awaitable<void>> startTasks;
+
         // For each thread group at this priority level
         for (auto& [threadGroupId, regsInGroup] : threadGroups)
         {
@@ -253,55 +278,95 @@ namespace Test2
 
           if (!servicesForGroup.empty())
           {
-            std::exception_ptr startupException;
+            threadGroupIds.push_back(threadGroupId);
+            startTasks.push_back(DoStartThreadGroupServicesAsync(threadGroupId, std::move(servicesForGroup), priority, mainHost, threadHosts));
+          }
+        }
+
+        std::vector<std::exception_ptr> startupErrors;
+        if (config.StartupMode == ServiceStartupMode::Concurrent)
+        {
+          // Fan out all thread groups of this priority level and wait for the slowest one (the priority barrier)
+          auto results = co_await Util::WhenAllAsync(std::move(startTasks));
+          for (std::size_t i = 0; i < results.size(); ++i)
+          {
+            if (results[i])
+            {
+              startupErrors.push_back(results[i]);
+            }
+            else
+            {
+              // Track successfully started priority level
+              startedPriorities.push_back({priority, threadGroupIds[i]});
+            }
+          }
+        }
+        else
+        {
+          for (std::size_t i = 0; i < startTasks.size() && startupErrors.empty(); ++i)
+          {
             try
             {
-              if (threadGroupId == ThreadGroupConfig::MainThreadGroupId)
-              {
-                // Main thread group - use cooperative host
-                co_await mainHost.GetServiceHost()->TryStartServicesAsync(std::move(servicesForGroup), priority);
-              }
-              else
-              {
-                // Non-main thread group - use the pre-started ManagedThreadHost
-                auto it = threadHosts.find(threadGroupId);
-                if (it == threadHosts.end())
-                {
-                  throw std::runtime_error("Thread host not found for thread group");
-                }
-
-                // Start services on the managed thread host
-                co_await it->second->GetServiceHost()->TryStartServicesAsync(std::move(servicesForGroup), priority);
-              }
+              co_await std::move(startTasks[i]);
 
               // Track successfully started priority level
-              startedPriorities.push_back({priority, threadGroupId});
+              startedPriorities.push_back({priority, threadGroupIds[i]});
             }
             catch (...)
             {
-              startupException = std::current_exception();
+              startupErrors.push_back(std::current_exception());
             }
+          }
+        }
 
-            // Handle startup failure outside catch block (co_await not allowed in catch)
-            if (startupException)
-            {
-              // Rollback all previously started priority levels
-              auto rollbackErrors = co_await DoShutdownServicesAsync(std::move(startedPriorities), mainHost, std::move(threadHosts), stopToken);
+        // Handle startup failure outside catch block (co_await not allowed in catch)
+        if (!startupErrors.empty())
+        {
+          // Rollback all previously started priority levels
+          auto rollbackErrors = co_await DoShutdownServicesAsync(std::move(startedPriorities), mainHost, std::move(threadHosts), stopToken);
 
-              // Combine startup error with any rollback errors
-              std::vector<std::exception_ptr> allErrors;
-              allErrors.push_back(startupException);
-              allErrors.insert(allErrors.end(), rollbackErrors.begin(), rollbackErrors.end());
+          // Combine startup errors with any rollback errors
+          std::vector<std::exception_ptr> allErrors = std::move(startupErrors);
+          allErrors.insert(allErrors.end(), rollbackErrors.begin(), rollbackErrors.end());
 
-              throw Common::AggregateException("Service startup failed", std::move(allErrors));
-            }
-          }
+          throw Common::AggregateException("Service startup failed", std::move(allErrors));
         }
       }
 
       co_return;
     }
 
+    /// @brief Starts the services of one thread group at one priority level on the host that owns the thread group.
+    ///
+    /// @param threadGroupId The thread group the services belong to.
+    /// @param services The services to start. Ownership is transferred.
+    /// @param priority The priority level being started.
+    /// @param mainHost Reference to the main cooperative thread host.
+    /// @param threadHosts Map of the already started managed thread hosts.
+    /// @throws AggregateException if any of the services fail to start (the host has already rolled back the group).
+    static boost::asio::awaitable<void> DoStartThreadGroupServicesAsync(const ServiceThreadGroupId threadGroupId,
+                                                                        std::vector<StartServiceRecord> services,
+                                                                        const ServiceLaunchPriority priority, CooperativeThreadHost& mainHost,
+                                                                        const ThreadGroupHostsMap& threadHosts)
+    {
+      if (threadGroupId == ThreadGroupConfig::MainThreadGroupId)
+      {
+        // Main thread group - use cooperative host
+        co_await mainHost.GetServiceHost()->TryStartServicesAsync(std::move(services), priority);
+        co_return;
+      }
+
+      // Non-main thread group - use the pre-started ManagedThreadHost
+      auto it = threadHosts.find(threadGroupId);
+      if (it == threadHosts.end())
+      {
+        throw std::runtime_error("Thread host not found for thread group");
+      }
+
+      // Start services on the managed thread host
+      co_await it->second->GetServiceHost()->TryStartServicesAsync(std::move(services), priority);
+    }
+
     /// @brief Performs the actual shutdown of services and managed threads.
     ///
     /// Handles exceptions from both service shutdown and thread shutdown operations.
@@ -332,7 +397,7 @@ namespace Test2
         allErrors.push_back(exception);
         spdlog::error("DoShutdownAllServicePrioritiesAsync threw an exception during shutdown");
         // ThreadHosts were moved, so we have no hosts to shut down
-        serviceShutdownResult.ThreadHosts = {};
+        serviceShutdownResult.ThreadHosts.clear();
       }
 
       // Shutdown all managed threads in parallel
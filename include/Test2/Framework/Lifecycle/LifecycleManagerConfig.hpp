@@ -13,6 +13,9 @@
 //* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 //****************************************************************************************************************************************************
 
+#include <Test2/Framework/Host/Managed/ManagedThreadRunMode.hpp>
+#include <Test2/Framework/Lifecycle/ServiceStartupMode.hpp>
+
 namespace Test2
 {
   /// @brief Configuration for LifecycleManager.
@@ -22,8 +25,27 @@ namespace Test2
   /// logging level, or retry policies as needed.
   struct LifecycleManagerConfig
   {
+    /// @brief How the thread groups within a priority level are started.
+    ServiceStartupMode StartupMode{ServiceStartupMode::Sequential};
+
+    /// @brief How the managed threads drive their event loop, use ProcessTick for services that rely on Process().
+    ManagedThreadRunMode ThreadRunMode{ManagedThreadRunMode::EventLoop};
+
     /// @brief Default constructor.
     constexpr LifecycleManagerConfig() noexcept = default;
+
+    /// @brief Constructs a config with the given startup mode.
+    explicit constexpr LifecycleManagerConfig(const ServiceStartupMode startupMode) noexcept
+      : StartupMode(startupMode)
+    {
+    }
+
+    /// @brief Constructs a config with the given startup mode and managed thread run mode.
+    constexpr LifecycleManagerConfig(const ServiceStartupMode startupMode, const ManagedThreadRunMode threadRunMode) noexcept
+      : StartupMode(startupMode)
+      , ThreadRunMode(threadRunMode)
+    {
+    }
   };
 }
 
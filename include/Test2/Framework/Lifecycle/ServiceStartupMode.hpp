@@ -0,0 +1,32 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_LIFECYCLE_SERVICESTARTUPMODE_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_LIFECYCLE_SERVICESTARTUPMODE_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+namespace Test2
+{
+  /// @brief Controls how the thread groups of a single priority level are started.
+  ///
+  /// Priority levels are always started one after another (highest first), this only affects the thread groups within a level.
+  enum class ServiceStartupMode
+  {
+    /// @brief Thread groups are started one at a time, stopping at the first failure.
+    Sequential = 0,
+
+    /// @brief All thread groups of a priority level are started at the same time and the level completes when the slowest one is done.
+    ///        If any of them fail, every group of the level is still awaited so all errors are reported before rolling back.
+    Concurrent = 1
+  };
+}
+
+#endif
@@ -13,7 +13,9 @@
 //* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 //****************************************************************************************************************************************************
 
+#include <Test2/Framework/Provider/ServiceProviderGeneration.hpp>
 #include <Test2/Framework/Service/IService.hpp>
+#include <Test2/Framework/Service/ServiceId.hpp>
 #include <memory>
 #include <typeinfo>
 #include <vector>
@@ -59,6 +61,34 @@ namespace Test2
     /// @param rServices Reference to a vector that will be populated with the matching service instances.
     /// @return true if one or more services were found and added to rServices, false otherwise.
     virtual bool TryGetServices(const std::type_info& type, std::vector<std::shared_ptr<IService>>& rServices) const = 0;
+
+    /// @brief Attempts to retrieve the single service bound to a compile-time ServiceId.
+    ///
+    /// This is the fast path behind ServiceProvider::GetService<T>() for interfaces that declare a ServiceId.
+    /// The binding was validated when the service was registered, so the returned pointer refers to the
+    /// IService base of the interface and can be converted with a static_pointer_cast.
+    /// It returns nullptr whenever the answer is not a single bound service (nothing bound, several services
+    /// supporting the type or a provider without id support), the caller then falls back to the type based lookup.
+    ///
+    /// @param id The ServiceId declared by the interface.
+    /// @param type The type information of the interface, guards against an interface that inherited its base's Id.
+    /// @return A shared pointer to the bound service, or nullptr.
+    virtual std::shared_ptr<IService> TryGetUniqueService(const ServiceId id, const std::type_info& type) const
+    {
+      (void)id;
+      (void)type;
+      return nullptr;
+    }
+
+    /// @brief Retrieves the counter that changes whenever services are registered or unregistered.
+    ///
+    /// ServiceHandle uses it to keep a resolved service until the registrations change.
+    ///
+    /// @return The provider's generation counter, or nullptr if the provider does not track changes (handles then look up on every access).
+    virtual std::shared_ptr<const ServiceProviderGeneration> GetGeneration() const
+    {
+      return nullptr;
+    }
   };
 
 }
@@ -0,0 +1,123 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_PROVIDER_SERVICEHANDLE_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_PROVIDER_SERVICEHANDLE_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+
+#include <Test2/Framework/Provider/ServiceProvider.hpp>
+#include <Test2/Framework/Provider/ServiceProviderGeneration.hpp>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Test2
+{
+  /// @brief Caches a resolved service for code that looks its dependencies up lazily.
+  ///
+  /// The first access resolves the service through the ServiceProvider and remembers the provider's generation.
+  /// Later accesses compare the generation with a plain load and hand out the cached raw pointer, so there is no
+  /// lookup, cast or reference count update until a priority group is registered or unregistered.
+  ///
+  /// The handle keeps the resolved service alive. Like the provider itself it must only be used on the provider's thread.
+  /// Providers that do not track a generation are supported, the handle then resolves on every access.
+  ///
+  /// Example usage:
+  /// @code
+  /// ServiceHandle<IAddService> addService = provider.GetServiceHandle<IAddService>();
+  /// double sum = co_await addService->AddAsync(1.0, 2.0);
+  /// @endcode
+  template <typename T>
+  class ServiceHandle
+  {
+    static_assert(std::is_base_of_v<IService, T>, "T must inherit from IService");
+
+    ServiceProvider m_provider;
+    std::shared_ptr<const ServiceProviderGeneration> m_generation;
+    std::uint64_t m_cachedGeneration{ServiceProviderGeneration::Expired};
+    std::shared_ptr<T> m_service;
+
+  public:
+    /// @brief Creates a handle that resolves T through the given provider on first use.
+    explicit ServiceHandle(ServiceProvider provider)
+      : m_provider(std::move(provider))
+    {
+    }
+
+    /// @brief Checks if the cached result is still valid, without touching the provider.
+    [[nodiscard]] bool IsCurrent() const noexcept
+    {
+      return m_generation && m_generation->Value == m_cachedGeneration;
+    }
+
+    /// @brief Gets the service, resolving it again only if the registrations changed since the last access.
+    /// @return The service, or nullptr if it is not registered or the provider expired (like ServiceProvider::TryGetService<T>()).
+    T* TryGet()
+    {
+      if (!IsCurrent())
+      {
+        Store(m_provider.GetGeneration(), m_provider.TryGetService<T>());
+      }
+      return m_service.get();
+    }
+
+    /// @brief Gets the service, resolving it again only if the registrations changed since the last access.
+    /// @return The service.
+    /// @throws The exceptions of ServiceProvider::GetService<T>() if the service has to be resolved and can not be.
+    T& Get()
+    {
+      if (!IsCurrent() || !m_service)
+      {
+        Store(m_provider.GetGeneration(), m_provider.GetService<T>());
+      }
+      return *m_service;
+    }
+
+    T* operator->()
+    {
+      return &Get();
+    }
+
+    T& operator*()
+    {
+      return Get();
+    }
+
+    /// @brief Gets a shared reference to the service, for callers that need to extend its lifetime.
+    /// @return The service, or nullptr if it is not available.
+    std::shared_ptr<T> TryGetShared()
+    {
+      TryGet();
+      return m_service;
+    }
+
+    /// @brief Drops the cached service so the next access resolves it again.
+    void Reset() noexcept
+    {
+      m_generation.reset();
+      m_cachedGeneration = ServiceProviderGeneration::Expired;
+      m_service.reset();
+    }
+
+  private:
+    void Store(std::shared_ptr<const ServiceProviderGeneration> generation, std::shared_ptr<T> service)
+    {
+      // The generation is read before the lookup, a change in between is caught by the next access
+      m_cachedGeneration = generation ? generation->Value : ServiceProviderGeneration::Expired;
+      m_generation = std::move(generation);
+      m_service = std::move(service);
+    }
+  };
+}
+
+#endif
@@ -15,9 +15,11 @@
 
 #include <Test2/Framework/Exception/ServiceCastException.hpp>
 #include <Test2/Framework/Provider/IServiceProvider.hpp>
+#include <Test2/Framework/Service/ServiceId.hpp>
 #include <spdlog/spdlog.h>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace Test2
@@ -46,7 +48,14 @@ namespace Test2
   /// if (provider.TryGetServices<IMyService>(services)) {
   ///   // Process services
   /// }
+  ///
+  /// // Resolve lazily and reuse the result until services are (un)registered
+  /// auto handle = provider.GetServiceHandle<IMyService>();
+  /// handle->DoWork();
   /// @endcode
+  template <typename T>
+  class ServiceHandle;
+
   class ServiceProvider
   {
     std::weak_ptr<IServiceProvider> m_provider;
@@ -74,15 +83,33 @@ namespace Test2
     /// @return true if one or more services were found, false otherwise.
     bool TryGetServices(const std::type_info& type, std::vector<std::shared_ptr<IService>>& rServices) const;
 
+    /// @brief Tries to get the single service bound to a compile-time ServiceId.
+    /// @param id The ServiceId declared by the interface.
+    /// @param type The type_info of the interface the id belongs to.
+    /// @return The bound service, or nullptr if there is no single bound service or the provider expired.
+    std::shared_ptr<IService> TryGetUniqueService(const ServiceId id, const std::type_info& type) const;
+
+    /// @brief Gets the generation counter of the underlying provider.
+    /// @return The counter, or nullptr if the provider does not track changes or has expired.
+    std::shared_ptr<const ServiceProviderGeneration> GetGeneration() const;
+
     /// @brief Gets a service and casts it to the specified type.
     /// @tparam T The interface type to retrieve and cast to. Must inherit from IService.
     /// @return A shared pointer to the service cast to type T.
     /// @throws UnknownServiceException if the service is not found.
     /// @throws ServiceCastException if the cast to type T fails.
+    /// @note If T declares a ServiceId the lookup is a slot index and a static_pointer_cast.
     template <typename T>
     std::shared_ptr<T> GetService() const
     {
       static_assert(std::is_base_of_v<IService, T>, "T must inherit from IService");
+      if constexpr (HasServiceId<T>)
+      {
+        if (auto bound = TryGetUniqueService(T::Id, typeid(T)))
+        {
+          return std::static_pointer_cast<T>(std::move(bound));
+        }
+      }
       auto service = GetService(typeid(T));
       auto result = std::dynamic_pointer_cast<T>(service);
       if (!result)
@@ -96,10 +123,18 @@ namespace Test2
     /// @tparam T The interface type to retrieve and cast to. Must inherit from IService.
     /// @return A shared pointer to the service cast to type T, or nullptr if not found or cast fails.
     /// @note If a service is found but the cast fails, an error is logged as this indicates a fundamental error.
+    /// @note If T declares a ServiceId the lookup is a slot index and a static_pointer_cast.
     template <typename T>
     std::shared_ptr<T> TryGetService() const
     {
       static_assert(std::is_base_of_v<IService, T>, "T must inherit from IService");
+      if constexpr (HasServiceId<T>)
+      {
+        if (auto bound = TryGetUniqueService(T::Id, typeid(T)))
+        {
+          return std::static_pointer_cast<T>(std::move(bound));
+        }
+      }
       auto service = TryGetService(typeid(T));
       if (!service)
       {
@@ -144,6 +179,17 @@ namespace Test2
       }
       return !rServices.empty();
     }
+
+    /// @brief Creates a handle that resolves the service on first use and keeps it until the provider's registrations change.
+    /// @tparam T The interface type to resolve. Must inherit from IService.
+    /// @return A handle bound to this provider.
+    /// @note Requires Test2/Framework/Provider/ServiceHandle.hpp.
+    template <typename T>
+    ServiceHandle<T> GetServiceHandle() const
+    {
+      static_assert(std::is_base_of_v<IService, T>, "T must inherit from IService");
+      return ServiceHandle<T>(*this);
+    }
   };
 }
 
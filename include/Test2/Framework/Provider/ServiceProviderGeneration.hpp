@@ -0,0 +1,34 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_PROVIDER_SERVICEPROVIDERGENERATION_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_PROVIDER_SERVICEPROVIDERGENERATION_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+
+#include <cstdint>
+
+namespace Test2
+{
+  /// @brief Counter a service provider bumps whenever the set of registered services changes.
+  ///
+  /// Providers hand out a shared_ptr to it so ServiceHandle can detect changes with a plain load instead of a new lookup.
+  /// It is only written and read on the provider's thread.
+  struct ServiceProviderGeneration
+  {
+    /// @brief Value used once the provider is destroyed, live providers never use it.
+    static constexpr std::uint64_t Expired = 0;
+
+    std::uint64_t Value{1};
+  };
+}
+
+#endif
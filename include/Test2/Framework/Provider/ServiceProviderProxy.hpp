@@ -51,6 +51,8 @@ namespace Test2
     std::shared_ptr<IService> GetService(const std::type_info& type) const override;
     std::shared_ptr<IService> TryGetService(const std::type_info& type) const override;
     bool TryGetServices(const std::type_info& type, std::vector<std::shared_ptr<IService>>& rServices) const override;
+    std::shared_ptr<IService> TryGetUniqueService(const ServiceId id, const std::type_info& type) const override;
+    std::shared_ptr<const ServiceProviderGeneration> GetGeneration() const override;
   };
 }
 
@@ -17,6 +17,7 @@
 #include <Test2/Framework/Service/ProcessResult.hpp>
 #include <Test2/Framework/Service/ServiceInitResult.hpp>
 #include <Test2/Framework/Service/ServiceShutdownResult.hpp>
+#include <Test2/Framework/Service/ServiceTickPolicy.hpp>
 #include <boost/asio/awaitable.hpp>
 
 namespace Test2
@@ -32,6 +33,12 @@ namespace Test2
     virtual boost::asio::awaitable<ServiceShutdownResult> ShutdownAsync() = 0;
 
     virtual ProcessResult Process() = 0;
+
+    /// @brief Declares how often Process() needs to be called, queried once when the service is registered.
+    virtual ServiceTickPolicy GetTickPolicy() const
+    {
+      return ServiceTickPolicy::EveryTick();
+    }
   };
 
 }
@@ -14,6 +14,7 @@
 //****************************************************************************************************************************************************
 
 #include <Test2/Framework/Service/IServiceControl.hpp>
+#include <Test2/Framework/Service/ServiceIdBinding.hpp>
 #include <memory>
 #include <span>
 #include <typeindex>
@@ -45,6 +46,17 @@ namespace Test2
     /// @return A span of type_index objects for the supported interface types.
     virtual std::span<const std::type_index> GetSupportedInterfaces() const = 0;
 
+    /// @brief Retrieves the compile-time ServiceId bindings of the supported interfaces.
+    ///
+    /// This is optional, interfaces without a binding are still found through the type based lookups.
+    /// Every binding must refer to one of the types returned by GetSupportedInterfaces().
+    ///
+    /// @return A span of bindings created with MakeServiceIdBinding, empty by default.
+    virtual std::span<const ServiceIdBinding> GetSupportedServiceIds() const
+    {
+      return {};
+    }
+
     /// @brief Creates a new service instance of the specified type.
     ///
     /// This method instantiates a service that implements the requested interface type.
@@ -0,0 +1,60 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_SERVICE_SERVICEID_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_SERVICE_SERVICEID_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace Test2
+{
+  /// @brief Compile-time identity of a service interface.
+  ///
+  /// The value is used directly as a slot index by the service providers, so ids should be small and dense, and ids above MaxValue are
+  /// rejected at registration.
+  /// Interfaces opt in by declaring a constant named Id:
+  /// @code
+  /// class IMyService : public IService
+  /// {
+  /// public:
+  ///   static constexpr ServiceId Id{42};
+  /// };
+  /// @endcode
+  struct ServiceId
+  {
+    /// @brief The largest id a provider accepts, it bounds the size of the providers' slot tables.
+    static constexpr std::uint32_t MaxValue = 4095;
+
+    std::uint32_t Value{0};
+
+    constexpr ServiceId() noexcept = default;
+
+    constexpr explicit ServiceId(const std::uint32_t value) noexcept
+      : Value(value)
+    {
+    }
+
+    constexpr bool operator==(const ServiceId& other) const noexcept = default;
+  };
+
+  /// @brief Satisfied by service interfaces that declare a compile-time ServiceId.
+  template <typename T>
+  concept HasServiceId = requires {
+    requires std::same_as<std::remove_cvref_t<decltype(T::Id)>, ServiceId>;
+    typename std::integral_constant<std::uint32_t, T::Id.Value>;
+    requires T::Id.Value <= ServiceId::MaxValue;
+  };
+}
+
+#endif
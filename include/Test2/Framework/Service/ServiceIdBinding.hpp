@@ -0,0 +1,48 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_SERVICE_SERVICEIDBINDING_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_SERVICE_SERVICEIDBINDING_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Framework/Service/IService.hpp>
+#include <Test2/Framework/Service/IServiceControl.hpp>
+#include <Test2/Framework/Service/ServiceId.hpp>
+#include <memory>
+#include <type_traits>
+#include <typeinfo>
+
+namespace Test2
+{
+  /// @brief Connects a service interface's compile-time ServiceId to the type used by the type based lookups.
+  ///
+  /// Bind converts a service instance to the interface once, at registration, so typed lookups by id can use a static_pointer_cast.
+  /// The returned IService pointer refers to the interface's own IService base, which is not the one IServiceControl derives from
+  /// when a service implements both.
+  struct ServiceIdBinding
+  {
+    ServiceId Id;
+    const std::type_info* pType{nullptr};
+    std::shared_ptr<IService> (*Bind)(const std::shared_ptr<IServiceControl>& service){nullptr};
+  };
+
+  /// @brief Creates the binding for a service interface that declares a ServiceId.
+  template <HasServiceId T>
+  constexpr ServiceIdBinding MakeServiceIdBinding() noexcept
+  {
+    static_assert(std::is_base_of_v<IService, T>, "T must inherit from IService");
+    return ServiceIdBinding{T::Id, &typeid(T),
+                            [](const std::shared_ptr<IServiceControl>& service) -> std::shared_ptr<IService>
+                            { return std::dynamic_pointer_cast<T>(service); }};
+  }
+}
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_SERVICE_SERVICETICKPOLICY_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_SERVICE_SERVICETICKPOLICY_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+
+#include <chrono>
+
+namespace Test2
+{
+  /// @brief How often a service wants IServiceControl::Process() to be called.
+  enum class ServiceTickMode
+  {
+    /// @brief Process() is never called, the service only does work from its own handlers.
+    Never = 0,
+
+    /// @brief Process() is called on every host tick.
+    EveryTick = 1,
+
+    /// @brief Process() is called once per period, the host sleeps until the next service is due.
+    Periodic = 2
+  };
+
+  /// @brief The tick requirement a service declares through IServiceControl::GetTickPolicy().
+  ///
+  /// The host asks for it once when the service is registered.
+  struct ServiceTickPolicy
+  {
+    ServiceTickMode Mode{ServiceTickMode::EveryTick};
+    std::chrono::nanoseconds Period{};
+
+    /// @brief Create a policy for a service that never needs Process().
+    [[nodiscard]] static constexpr ServiceTickPolicy Never() noexcept
+    {
+      return ServiceTickPolicy{ServiceTickMode::Never, {}};
+    }
+
+    /// @brief Create a policy for a service that needs Process() on every tick.
+    [[nodiscard]] static constexpr ServiceTickPolicy EveryTick() noexcept
+    {
+      return ServiceTickPolicy{ServiceTickMode::EveryTick, {}};
+    }
+
+    /// @brief Create a policy for a service that needs Process() once per period.
+    /// @param period Time between two Process() calls, a non positive period behaves like EveryTick.
+    [[nodiscard]] static constexpr ServiceTickPolicy Periodic(const std::chrono::nanoseconds period) noexcept
+    {
+      return period > std::chrono::nanoseconds::zero() ? ServiceTickPolicy{ServiceTickMode::Periodic, period} : EveryTick();
+    }
+
+    constexpr bool operator==(const ServiceTickPolicy& other) const noexcept = default;
+  };
+}
+
+#endif
@@ -16,11 +16,20 @@
 #include <Test2/Framework/Exception/ServiceDisposedException.hpp>
 #include <Test2/Framework/Lifecycle/DispatchContext.hpp>
 #include <Test2/Framework/Lifecycle/ExecutorContext.hpp>
+#include <Test2/Framework/Util/FramePool.hpp>
 #include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/associated_executor.hpp>
+#include <boost/asio/async_result.hpp>
 #include <boost/asio/awaitable.hpp>
 #include <boost/asio/co_spawn.hpp>
+#include <boost/asio/execution/allocator.hpp>
+#include <boost/asio/execution/blocking.hpp>
+#include <boost/asio/execution/outstanding_work.hpp>
+#include <boost/asio/io_context.hpp>
 #include <boost/asio/post.hpp>
+#include <boost/asio/require.hpp>
 #include <boost/asio/use_awaitable.hpp>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -55,6 +64,191 @@ namespace Test2
 
       template <typename T>
       using awaitable_value_t = typename is_awaitable<T>::value_type;
+
+      /// @brief Checks if the calling thread is currently running handlers of the given executor.
+      inline bool IsRunningInThisThread(const boost::asio::any_io_executor& executor) noexcept
+      {
+        const auto* ioExecutor = executor.target<boost::asio::io_context::executor_type>();
+        return ioExecutor != nullptr && ioExecutor->running_in_this_thread();
+      }
+
+      /// @brief Awaits the operation, which the coroutine frame owns for the whole call.
+      template <typename ResultType, typename Operation>
+      boost::asio::awaitable<ResultType> AwaitInlineAsync(Operation operation)
+      {
+        // co_return of a void expression is fine, it ends up in return_void()
+        co_return co_await operation();
+      }
+
+      /// @brief Calls the invoker from a coroutine frame, which the thread's frame recycling cache serves without touching the heap.
+      template <typename ResultType, typename Invoker>
+      boost::asio::awaitable<ResultType> InvokeInlineAsync(Invoker invoker)
+      {
+        co_return invoker();
+      }
+
+      /// @brief The completion signature co_spawn uses for an awaitable<ResultType>.
+      template <typename ResultType>
+      struct CompletionSignatureOf
+      {
+        using type = void(std::exception_ptr, ResultType);
+      };
+
+      template <>
+      struct CompletionSignatureOf<void>
+      {
+        using type = void(std::exception_ptr);
+      };
+
+      template <typename ResultType>
+      using CompletionSignature = typename CompletionSignatureOf<ResultType>::type;
+
+      /// @brief The io_context executor that never runs a function inline and takes the memory for it from the posting thread's
+      ///        FramePool.
+      inline auto MakePooledExecutor(const boost::asio::io_context::executor_type& executor)
+      {
+        return boost::asio::require(executor, boost::asio::execution::blocking.never,
+                                    boost::asio::execution::allocator(FramePoolAllocator<void>()));
+      }
+
+      using PooledCallerExecutor = decltype(boost::asio::require(MakePooledExecutor(std::declval<boost::asio::io_context::executor_type>()),
+                                                                 boost::asio::execution::outstanding_work.tracked));
+
+      /// @brief Completes a cross-thread call by posting the result to the awaiting coroutine's io_context.
+      ///
+      /// The caller's io_context counts the call as outstanding work until the result is posted, like co_spawn does for its handler.
+      template <typename Handler>
+      class ResumeOnCaller
+      {
+        Handler m_handler;
+        PooledCallerExecutor m_callerExecutor;
+
+      public:
+        ResumeOnCaller(Handler handler, const boost::asio::io_context::executor_type& callerExecutor)
+          : m_handler(std::move(handler))
+          , m_callerExecutor(boost::asio::require(MakePooledExecutor(callerExecutor), boost::asio::execution::outstanding_work.tracked))
+        {
+        }
+
+        template <typename... Values>
+        void operator()(std::exception_ptr error, Values... values)
+        {
+          m_callerExecutor.execute([handler = std::move(m_handler), error = std::move(error), ... values = std::move(values)]() mutable
+                                   { handler(std::move(error), std::move(values)...); });
+        }
+      };
+
+      /// @brief Checks that both the target and the awaiting coroutine run on an io_context, which PostToTarget requires.
+      template <typename Handler>
+      bool CanPostToTarget(const boost::asio::any_io_executor& executor, const Handler& handler) noexcept
+      {
+        return executor.target<boost::asio::io_context::executor_type>() != nullptr &&
+               boost::asio::get_associated_executor(handler).template target<boost::asio::io_context::executor_type>() != nullptr;
+      }
+
+      /// @brief Posts the function to the target io_context, it gets a ResumeOnCaller to complete the call with.
+      ///
+      /// Both the function and the result take their memory from the posting thread's FramePool, so a steady stream of calls between
+      /// two threads keeps reusing the same blocks.
+      template <typename Handler, typename Function>
+      void PostToTarget(const boost::asio::any_io_executor& executor, Handler handler, Function function)
+      {
+        const auto callerExecutor = boost::asio::get_associated_executor(handler);
+        ResumeOnCaller<Handler> resume(std::move(handler), *callerExecutor.template target<boost::asio::io_context::executor_type>());
+        MakePooledExecutor(*executor.target<boost::asio::io_context::executor_type>())
+          .execute([resume = std::move(resume), function = std::move(function)]() mutable { function(std::move(resume)); });
+      }
+
+      /// @brief Calls the invoker on the target thread and completes the call with its result or exception.
+      template <typename ResultType, typename Invoker, typename Resume>
+      void InvokeAndResume(Invoker& rInvoker, Resume resume)
+      {
+        std::exception_ptr error;
+        if constexpr (std::is_void_v<ResultType>)
+        {
+          try
+          {
+            rInvoker();
+          }
+          catch (...)
+          {
+            error = std::current_exception();
+          }
+          resume(std::move(error));
+        }
+        else
+        {
+          std::optional<ResultType> result;
+          try
+          {
+            result.emplace(rInvoker());
+          }
+          catch (...)
+          {
+            error = std::current_exception();
+          }
+          resume(std::move(error), result ? std::move(*result) : ResultType{});
+        }
+      }
+
+      /// @brief Runs the operation on the executor and resumes the awaiting coroutine on its own executor.
+      ///
+      /// If the caller is already running on the executor the operation is awaited inline, which skips the queue round trip.
+      /// Otherwise the operation is posted to the target thread and co_spawned there, so its frames are allocated and freed by the
+      /// target thread's frame recycling cache, and the result is posted back. Both posts take their memory from FramePool. The
+      /// operation is the same in both cases, so the lifetime check and exceptions behave identically.
+      ///
+      /// This is not a coroutine, the executor check happens when the call is made. Like every proxied call, the returned
+      /// awaitable must be awaited by the calling coroutine without switching threads first.
+      template <typename ResultType, typename Operation>
+      boost::asio::awaitable<ResultType> DispatchAsync(const boost::asio::any_io_executor& executor, Operation operation)
+      {
+        if (IsRunningInThisThread(executor))
+        {
+          return AwaitInlineAsync<ResultType>(std::move(operation));
+        }
+
+        auto initiation = [executor](auto handler, Operation operation)
+        {
+          if (!CanPostToTarget(executor, handler))
+          {
+            boost::asio::co_spawn(executor, std::move(operation), std::move(handler));
+            return;
+          }
+          PostToTarget(executor, std::move(handler),
+                       [executor, operation = std::move(operation)](auto resume) mutable
+                       { boost::asio::co_spawn(executor, std::move(operation), std::move(resume)); });
+        };
+        return boost::asio::async_initiate<const boost::asio::use_awaitable_t<>&, CompletionSignature<ResultType>>(
+          std::move(initiation), boost::asio::use_awaitable, std::move(operation));
+      }
+
+      /// @brief Like DispatchAsync, but for a plain (non-coroutine) invoker.
+      ///
+      /// A call on the same executor costs the single InvokeInlineAsync frame. Across threads the invoker runs straight from the
+      /// posted function, without a coroutine on the target thread.
+      template <typename ResultType, typename Invoker>
+      boost::asio::awaitable<ResultType> DispatchInvokeAsync(const boost::asio::any_io_executor& executor, Invoker invoker)
+      {
+        if (IsRunningInThisThread(executor))
+        {
+          return InvokeInlineAsync<ResultType>(std::move(invoker));
+        }
+
+        auto initiation = [executor](auto handler, Invoker invoker)
+        {
+          if (!CanPostToTarget(executor, handler))
+          {
+            auto operation = [invoker = std::move(invoker)]() mutable -> boost::asio::awaitable<ResultType> { co_return invoker(); };
+            boost::asio::co_spawn(executor, std::move(operation), std::move(handler));
+            return;
+          }
+          PostToTarget(executor, std::move(handler),
+                       [invoker = std::move(invoker)](auto resume) mutable { InvokeAndResume<ResultType>(invoker, std::move(resume)); });
+        };
+        return boost::asio::async_initiate<const boost::asio::use_awaitable_t<>&, CompletionSignature<ResultType>>(
+          std::move(initiation), boost::asio::use_awaitable, std::move(invoker));
+      }
     }    // namespace Detail
 
     // ========================================================================================================
@@ -93,47 +287,44 @@ namespace Test2
         // Member function returns awaitable<U>, extract U
         using ResultType = Detail::awaitable_value_t<RawResultType>;
 
-        return boost::asio::co_spawn(
-          executor,
-          [weakPtr, func = std::mem_fn(memberFunc), ... args = std::forward<Args>(args)]() mutable -> boost::asio::awaitable<ResultType>
+        auto operation = [weakPtr, func = std::mem_fn(memberFunc),
+                          ... args = std::forward<Args>(args)]() mutable -> boost::asio::awaitable<ResultType>
+        {
+          auto ptr = weakPtr.lock();
+          if (!ptr)
           {
-            auto ptr = weakPtr.lock();
-            if (!ptr)
-            {
-              throw ServiceDisposedException(DebugHintName);
-            }
+            throw ServiceDisposedException(DebugHintName);
+          }
 
-            // Invoke returns awaitable, so we need to co_await it
-            co_return co_await func(ptr, std::move(args)...);
-          },
-          boost::asio::use_awaitable);
+          // Invoke returns awaitable, so we need to co_await it
+          co_return co_await func(ptr, std::move(args)...);
+        };
+        return Detail::DispatchAsync<ResultType>(executor, std::move(operation));
       }
       else
       {
         // Member function returns regular type
         using ResultType = RawResultType;
 
-        return boost::asio::co_spawn(
-          executor,
-          [weakPtr, func = std::mem_fn(memberFunc), ... args = std::forward<Args>(args)]() mutable -> boost::asio::awaitable<ResultType>
+        auto invoker = [weakPtr, func = std::mem_fn(memberFunc), ... args = std::forward<Args>(args)]() mutable -> ResultType
+        {
+          auto ptr = weakPtr.lock();
+          if (!ptr)
           {
-            auto ptr = weakPtr.lock();
-            if (!ptr)
-            {
-              throw ServiceDisposedException(DebugHintName);
-            }
+            throw ServiceDisposedException(DebugHintName);
+          }
 
-            if constexpr (std::is_void_v<ResultType>)
-            {
-              func(ptr, std::move(args)...);
-              co_return;
-            }
-            else
-            {
-              co_return func(ptr, std::move(args)...);
-            }
-          },
-          boost::asio::use_awaitable);
+          if constexpr (std::is_void_v<ResultType>)
+          {
+            func(ptr, std::move(args)...);
+            return;
+          }
+          else
+          {
+            return func(ptr, std::move(args)...);
+          }
+        };
+        return Detail::DispatchInvokeAsync<ResultType>(executor, std::move(invoker));
       }
     }
 
@@ -168,34 +359,33 @@ namespace Test2
         using ResultType = Detail::awaitable_value_t<RawResultType>;
         using ReturnType = std::conditional_t<std::is_void_v<ResultType>, bool, std::optional<ResultType>>;
 
-        return boost::asio::co_spawn(
-          executor,
-          [weakPtr, func = std::mem_fn(memberFunc), ... args = std::forward<Args>(args)]() mutable -> boost::asio::awaitable<ReturnType>
+        auto operation = [weakPtr, func = std::mem_fn(memberFunc),
+                          ... args = std::forward<Args>(args)]() mutable -> boost::asio::awaitable<ReturnType>
+        {
+          auto ptr = weakPtr.lock();
+          if (!ptr)
           {
-            auto ptr = weakPtr.lock();
-            if (!ptr)
-            {
-              if constexpr (std::is_void_v<ResultType>)
-              {
-                co_return false;
-              }
-              else
-              {
-                co_return std::nullopt;
-              }
-            }
-
             if constexpr (std::is_void_v<ResultType>)
             {
-              co_await func(ptr, std::move(args)...);
-              co_return true;
+              co_return false;
             }
             else
             {
-              co_return std::optional<ResultType>(co_await func(ptr, std::move(args)...));
+              co_return std::nullopt;
             }
-          },
-          boost::asio::use_awaitable);
+          }
+
+          if constexpr (std::is_void_v<ResultType>)
+          {
+            co_await func(ptr, std::move(args)...);
+            co_return true;
+          }
+          else
+          {
+            co_return std::optional<ResultType>(co_await func(ptr, std::move(args)...));
+          }
+        };
+        return Detail::DispatchAsync<ReturnType>(executor, std::move(operation));
       }
       else
       {
@@ -203,34 +393,32 @@ namespace Test2
         using ResultType = RawResultType;
         using ReturnType = std::conditional_t<std::is_void_v<ResultType>, bool, std::optional<ResultType>>;
 
-        return boost::asio::co_spawn(
-          executor,
-          [weakPtr, func = std::mem_fn(memberFunc), ... args = std::forward<Args>(args)]() mutable -> boost::asio::awaitable<ReturnType>
+        auto invoker = [weakPtr, func = std::mem_fn(memberFunc), ... args = std::forward<Args>(args)]() mutable -> ReturnType
+        {
+          auto ptr = weakPtr.lock();
+          if (!ptr)
           {
-            auto ptr = weakPtr.lock();
-            if (!ptr)
-            {
-              if constexpr (std::is_void_v<ResultType>)
-              {
-                co_return false;
-              }
-              else
-              {
-                co_return std::nullopt;
-              }
-            }
-
             if constexpr (std::is_void_v<ResultType>)
             {
-              func(ptr, std::move(args)...);
-              co_return true;
+              return false;
             }
             else
             {
-              co_return std::optional<ResultType>(func(ptr, std::move(args)...));
+              return std::nullopt;
             }
-          },
-          boost::asio::use_awaitable);
+          }
+
+          if constexpr (std::is_void_v<ResultType>)
+          {
+            func(ptr, std::move(args)...);
+            return true;
+          }
+          else
+          {
+            return std::optional<ResultType>(func(ptr, std::move(args)...));
+          }
+        };
+        return Detail::DispatchInvokeAsync<ReturnType>(executor, std::move(invoker));
       }
     }
 
@@ -281,6 +469,10 @@ namespace Test2
     /// and returns to the source executor. It properly handles both regular functions and functions
     /// that return awaitable<T>.
     ///
+    /// The call is a single hop: the operation is spawned directly on the target executor and the awaiting coroutine is
+    /// resumed on its own executor when it completes, which is the source executor as proxies are called from their source.
+    /// There is no intermediate coroutine on the source executor.
+    ///
     /// @tparam DebugHintName Optional debug hint for exception messages (compile-time const char*).
     /// @tparam TSource Type of the source object managed by the DispatchContext.
     /// @tparam TTarget Type of the target object managed by the DispatchContext.
@@ -294,118 +486,14 @@ namespace Test2
     template <const char* DebugHintName = kEmptyDebugHint, typename TSource, typename TTarget, typename MemberFunc, typename... Args>
     auto InvokeAsync(const DispatchContext<TSource, TTarget>& context, MemberFunc memberFunc, Args&&... args)
     {
-      using RawResultType = std::invoke_result_t<MemberFunc, TTarget*, std::decay_t<Args>...>;
-      auto sourceExecutor = context.GetSourceExecutor();
-      auto targetExecutor = context.GetTargetExecutor();
-      auto weakPtr = context.GetTargetContext().GetWeakPtr();
-
-      // Check if the member function returns an awaitable
-      if constexpr (Detail::is_awaitable_v<RawResultType>)
-      {
-        // Member function returns awaitable<U>, extract U
-        using ResultType = Detail::awaitable_value_t<RawResultType>;
-
-        return boost::asio::co_spawn(
-          sourceExecutor,
-          [targetExecutor, weakPtr, func = std::mem_fn(memberFunc),
-           ... args = std::forward<Args>(args)]() mutable -> boost::asio::awaitable<ResultType>
-          {
-            // Execute on target thread
-            if constexpr (std::is_void_v<ResultType>)
-            {
-              co_await boost::asio::co_spawn(
-                targetExecutor,
-                [weakPtr, func = std::move(func), ... args = std::move(args)]() mutable -> boost::asio::awaitable<void>
-                {
-                  auto ptr = weakPtr.lock();
-                  if (!ptr)
-                  {
-                    throw ServiceDisposedException(DebugHintName);
-                  }
-
-                  co_await func(ptr, std::move(args)...);
-                  co_return;
-                },
-                boost::asio::use_awaitable);
-              co_return;
-            }
-            else
-            {
-              auto result = co_await boost::asio::co_spawn(
-                targetExecutor,
-                [weakPtr, func = std::move(func), ... args = std::move(args)]() mutable -> boost::asio::awaitable<ResultType>
-                {
-                  auto ptr = weakPtr.lock();
-                  if (!ptr)
-                  {
-                    throw ServiceDisposedException(DebugHintName);
-                  }
-
-                  co_return co_await func(ptr, std::move(args)...);
-                },
-                boost::asio::use_awaitable);
-
-              co_return result;
-            }
-          },
-          boost::asio::use_awaitable);
-      }
-      else
-      {
-        // Member function returns regular type
-        using ResultType = RawResultType;
-
-        return boost::asio::co_spawn(
-          sourceExecutor,
-          [targetExecutor, weakPtr, func = std::mem_fn(memberFunc),
-           ... args = std::forward<Args>(args)]() mutable -> boost::asio::awaitable<ResultType>
-          {
-            // Execute on target thread
-            if constexpr (std::is_void_v<ResultType>)
-            {
-              co_await boost::asio::co_spawn(
-                targetExecutor,
-                [weakPtr, func = std::move(func), ... args = std::move(args)]() mutable -> boost::asio::awaitable<void>
-                {
-                  auto ptr = weakPtr.lock();
-                  if (!ptr)
-                  {
-                    throw ServiceDisposedException(DebugHintName);
-                  }
-
-                  func(ptr, std::move(args)...);
-                  co_return;
-                },
-                boost::asio::use_awaitable);
-              co_return;
-            }
-            else
-            {
-              auto result = co_await boost::asio::co_spawn(
-                targetExecutor,
-                [weakPtr, func = std::move(func), ... args = std::move(args)]() mutable -> boost::asio::awaitable<ResultType>
-                {
-                  auto ptr = weakPtr.lock();
-                  if (!ptr)
-                  {
-                    throw ServiceDisposedException(DebugHintName);
-                  }
-
-                  co_return func(ptr, std::move(args)...);
-                },
-                boost::asio::use_awaitable);
-
-              co_return result;
-            }
-          },
-          boost::asio::use_awaitable);
-      }
+      return InvokeAsync<DebugHintName>(context.GetTargetContext(), memberFunc, std::forward<Args>(args)...);
     }
 
     /// @brief Invokes a member function using a DispatchContext, returning optional on expiration.
     ///
     /// This function handles cross-executor dispatch: the operation executes on the target executor
     /// and returns to the source executor. Instead of throwing, returns std::nullopt or false on expiration.
+    /// Like InvokeAsync, this is a single hop to the target executor and back.
     ///
     /// @tparam DebugHintName Optional debug hint (unused in non-throwing variant, kept for consistency).
     /// @tparam TSource Type of the source object managed by the DispatchContext.
@@ -420,100 +508,7 @@ namespace Test2
     template <const char* DebugHintName = kEmptyDebugHint, typename TSource, typename TTarget, typename MemberFunc, typename... Args>
     auto TryInvokeAsync(const DispatchContext<TSource, TTarget>& context, MemberFunc memberFunc, Args&&... args)
     {
-      using RawResultType = std::invoke_result_t<MemberFunc, TTarget*, std::decay_t<Args>...>;
-      auto sourceExecutor = context.GetSourceExecutor();
-      auto targetExecutor = context.GetTargetExecutor();
-      auto weakPtr = context.GetTargetContext().GetWeakPtr();
-
-      // Check if the member function returns an awaitable
-      if constexpr (Detail::is_awaitable_v<RawResultType>)
-      {
-        // Member function returns awaitable<U>, extract U
-        using ResultType = Detail::awaitable_value_t<RawResultType>;
-        using ReturnType = std::conditional_t<std::is_void_v<ResultType>, bool, std::optional<ResultType>>;
-
-        return boost::asio::co_spawn(
-          sourceExecutor,
-          [targetExecutor, weakPtr, func = std::mem_fn(memberFunc),
-           ... args = std::forward<Args>(args)]() mutable -> boost::asio::awaitable<ReturnType>
-          {
-            auto result = co_await boost::asio::co_spawn(
-              targetExecutor,
-              [weakPtr, func = std::move(func), ... args = std::move(args)]() mutable -> boost::asio::awaitable<ReturnType>
-              {
-                auto ptr = weakPtr.lock();
-                if (!ptr)
-                {
-                  if constexpr (std::is_void_v<ResultType>)
-                  {
-                    co_return false;
-                  }
-                  else
-                  {
-                    co_return std::nullopt;
-                  }
-                }
-
-                if constexpr (std::is_void_v<ResultType>)
-                {
-                  co_await func(ptr, std::move(args)...);
-                  co_return true;
-                }
-                else
-                {
-                  co_return std::optional<ResultType>(co_await func(ptr, std::move(args)...));
-                }
-              },
-              boost::asio::use_awaitable);
-
-            co_return result;
-          },
-          boost::asio::use_awaitable);
-      }
-      else
-      {
-        // Member function returns regular type
-        using ResultType = RawResultType;
-        using ReturnType = std::conditional_t<std::is_void_v<ResultType>, bool, std::optional<ResultType>>;
-
-        return boost::asio::co_spawn(
-          sourceExecutor,
-          [targetExecutor, weakPtr, func = std::mem_fn(memberFunc),
-           ... args = std::forward<Args>(args)]() mutable -> boost::asio::awaitable<ReturnType>
-          {
-            auto result = co_await boost::asio::co_spawn(
-              targetExecutor,
-              [weakPtr, func = std::move(func), ... args = std::move(args)]() mutable -> boost::asio::awaitable<ReturnType>
-              {
-                auto ptr = weakPtr.lock();
-                if (!ptr)
-                {
-                  if constexpr (std::is_void_v<ResultType>)
-                  {
-                    co_return false;
-                  }
-                  else
-                  {
-                    co_return std::nullopt;
-                  }
-                }
-
-                if constexpr (std::is_void_v<ResultType>)
-                {
-                  func(ptr, std::move(args)...);
-                  co_return true;
-                }
-                else
-                {
-                  co_return std::optional<ResultType>(func(ptr, std::move(args)...));
-                }
-              },
-              boost::asio::use_awaitable);
-
-            co_return result;
-          },
-          boost::asio::use_awaitable);
-      }
+      return TryInvokeAsync<DebugHintName>(context.GetTargetContext(), memberFunc, std::forward<Args>(args)...);
     }
 
   }    // namespace Util
@@ -0,0 +1,129 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_UTIL_ASYNCSIGNAL_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_UTIL_ASYNCSIGNAL_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace Test2
+{
+  namespace Util
+  {
+    /// @brief One-shot signal that can be set from any thread and awaited without blocking on the waiter's executor.
+    ///
+    /// This is the awaitable replacement for a std::promise<void>/std::future<void> pair: Set() hands the completion over to the
+    /// waiter's executor, so the waiting thread keeps running its other handlers instead of blocking in future.wait().
+    ///
+    /// Copies share the same signal, which makes it easy to capture in the thread that will set it.
+    ///
+    /// @note WaitAsync touches the timer directly, so it must be called from the thread that runs the executor the signal was
+    ///       created with, and that executor must not run handlers concurrently (a single threaded io_context or a strand).
+    class AsyncSignal
+    {
+      struct State
+      {
+        std::mutex Mutex;
+        bool IsSet{false};
+        std::exception_ptr Exception;
+        boost::asio::steady_timer Timer;
+
+        explicit State(const boost::asio::any_io_executor& executor)
+          : Timer(executor, boost::asio::steady_timer::time_point::max())
+        {
+        }
+      };
+
+      std::shared_ptr<State> m_state;
+
+    public:
+      /// @brief Creates an unset signal whose waiters are resumed on the given executor.
+      explicit AsyncSignal(const boost::asio::any_io_executor& executor)
+        : m_state(std::make_shared<State>(executor))
+      {
+      }
+
+      /// @brief Sets the signal, releasing current and future waiters. Thread safe.
+      /// @return true if this call set the signal, false if it had already been set.
+      bool Set()
+      {
+        return Complete(nullptr);
+      }
+
+      /// @brief Sets the signal with an exception that WaitAsync will rethrow. Thread safe.
+      /// @return true if this call set the signal, false if it had already been set.
+      bool SetException(std::exception_ptr exception)
+      {
+        return Complete(std::move(exception));
+      }
+
+      /// @brief Checks if the signal has been set. Thread safe.
+      [[nodiscard]] bool IsSet() const
+      {
+        std::lock_guard<std::mutex> lock(m_state->Mutex);
+        return m_state->IsSet;
+      }
+
+      /// @brief Waits until the signal is set.
+      /// @throws The exception given to SetException, if any.
+      boost::asio::awaitable<void> WaitAsync()
+      {
+        auto state = m_state;
+
+        // The expiry is only moved on the timer's executor, so if Set() already ran the wait completes immediately and
+        // if it has not, the wait is released when it does.
+        boost::system::error_code ec;
+        co_await state->Timer.async_wait(boost::asio::redirect_error(boost::asio::use_awaitable, ec));
+
+        std::exception_ptr exception;
+        {
+          std::lock_guard<std::mutex> lock(state->Mutex);
+          exception = state->Exception;
+        }
+        if (exception)
+        {
+          std::rethrow_exception(exception);
+        }
+      }
+
+    private:
+      bool Complete(std::exception_ptr exception)
+      {
+        {
+          std::lock_guard<std::mutex> lock(m_state->Mutex);
+          if (m_state->IsSet)
+          {
+            return false;
+          }
+          m_state->IsSet = true;
+          m_state->Exception = std::move(exception);
+        }
+
+        // The timer is not thread safe, so hand the wake up over to the waiter's executor
+        boost::asio::post(m_state->Timer.get_executor(),
+                          [state = m_state]() { state->Timer.expires_at(boost::asio::steady_timer::time_point::min()); });
+        return true;
+      }
+    };
+  }    // namespace Util
+}    // namespace Test2
+
+#endif
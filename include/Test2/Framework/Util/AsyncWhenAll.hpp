@@ -0,0 +1,94 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_UTIL_ASYNCWHENALL_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_UTIL_ASYNCWHENALL_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Test2
+{
+  namespace Util
+  {
+    /// @brief Runs all tasks concurrently on the calling coroutine's executor and waits for every one of them to finish.
+    ///
+    /// Each task is co_spawned immediately so they all make progress at the same time, which means work that hops to other
+    /// executors (like a TryStartServicesAsync call on a managed thread) overlaps instead of being serialized.
+    /// A failing task does not cancel the others; the join always waits for all of them.
+    ///
+    /// @note The calling executor must not run handlers concurrently (a single threaded io_context or a strand), since the
+    ///       join bookkeeping is updated from the task completion handlers without locking.
+    ///
+    /// @param tasks The tasks to run. Ownership is transferred.
+    /// @return One entry per task in the same order as the input. The entry is null if the task completed successfully,
+    ///         otherwise it holds the exception the task threw.
+    inline boost::asio::awaitable<std::vector<std::exception_ptr>> WhenAllAsync(std::vector<boost::asio::awaitable<void>> tasks)
+    {
+      struct JoinState
+      {
+        std::vector<std::exception_ptr> Errors;
+        std::size_t Pending;
+        boost::asio::steady_timer Completed;
+
+        JoinState(const std::size_t count, const boost::asio::any_io_executor& executor)
+          : Errors(count)
+          , Pending(count)
+          , Completed(executor, boost::asio::steady_timer::time_point::max())
+        {
+        }
+      };
+
+      if (tasks.empty())
+      {
+        co_return std::vector<std::exception_ptr>{};
+      }
+
+      auto executor = co_await boost::asio::this_coro::executor;
+      auto state = std::make_shared<JoinState>(tasks.size(), executor);
+
+      for (std::size_t i = 0; i < tasks.size(); ++i)
+      {
+        boost::asio::co_spawn(executor, std::move(tasks[i]),
+                              [state, i](std::exception_ptr ex)
+                              {
+                                state->Errors[i] = ex;
+                                if (--state->Pending == 0)
+                                {
+                                  // Moving the expiry (instead of cancel) also releases a waiter that has not started waiting yet
+                                  state->Completed.expires_at(boost::asio::steady_timer::time_point::min());
+                                }
+                              });
+      }
+
+      if (state->Pending > 0)
+      {
+        boost::system::error_code ec;
+        co_await state->Completed.async_wait(boost::asio::redirect_error(boost::asio::use_awaitable, ec));
+      }
+
+      co_return std::move(state->Errors);
+    }
+  }    // namespace Util
+}    // namespace Test2
+
+#endif
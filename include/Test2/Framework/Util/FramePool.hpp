@@ -0,0 +1,255 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_UTIL_FRAMEPOOL_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_UTIL_FRAMEPOOL_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace Test2
+{
+  namespace Util
+  {
+    /// @brief Per-thread pool of memory blocks for the handlers that carry proxied calls between threads.
+    ///
+    /// A block always returns to the pool of the thread that allocated it, also when another thread frees it. Frees on the owner
+    /// thread go to a plain free list, frees from other threads are pushed onto a lock-free list that the owner takes over with a
+    /// single exchange once its own list runs dry. A steady stream of calls between two threads therefore keeps cycling the same
+    /// blocks. asio's per-thread recycling cache instead keeps the memory on the freeing thread, so the allocating thread of a
+    /// cross-thread handler falls back to the heap on every call.
+    ///
+    /// The pool outlives its thread until the last block it handed out is freed, blocks freed after the thread exited go straight
+    /// back to the heap. Requests larger than the biggest block size always use the heap.
+    class FramePool
+    {
+    public:
+      static constexpr std::size_t SmallestBlockSize = 64;
+      static constexpr std::size_t BlockSizeCount = 5;
+      static constexpr std::size_t LargestBlockSize = SmallestBlockSize << (BlockSizeCount - 1);
+
+    private:
+      /// @brief Precedes every block, the payload starts right after it and keeps the default new alignment.
+      struct alignas(alignof(std::max_align_t)) Block
+      {
+        FramePool* pOwner{nullptr};
+        Block* pNext{nullptr};
+      };
+
+      std::array<Block*, BlockSizeCount> m_free{};
+      std::array<std::atomic<Block*>, BlockSizeCount> m_remoteFree{};
+      /// @brief One reference for the owner thread and one for every block taken from the heap.
+      std::atomic<std::size_t> m_referenceCount{1};
+
+      /// @brief Marks the remote lists of a pool whose thread exited.
+      static Block* ClosedList() noexcept
+      {
+        static Block closed;
+        return &closed;
+      }
+
+      static constexpr std::size_t GetBlockSizeIndex(const std::size_t size) noexcept
+      {
+        std::size_t index = 0;
+        while (index < BlockSizeCount && (SmallestBlockSize << index) < size)
+        {
+          ++index;
+        }
+        return index;
+      }
+
+      /// @brief Ends the owner thread's use of the pool.
+      struct ThreadPool
+      {
+        FramePool* pPool{nullptr};
+
+        ~ThreadPool()
+        {
+          if (pPool != nullptr)
+          {
+            pPool->Close();
+          }
+        }
+      };
+
+      static ThreadPool& GetThreadPool() noexcept
+      {
+        static thread_local ThreadPool threadPool;
+        return threadPool;
+      }
+
+      static void FreeBlock(Block* const pBlock) noexcept
+      {
+        FramePool* const pOwner = pBlock->pOwner;
+        pBlock->~Block();
+        ::operator delete(static_cast<void*>(pBlock));
+        pOwner->Release();
+      }
+
+      void Release() noexcept
+      {
+        if (m_referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+          delete this;
+        }
+      }
+
+      /// @brief Called on thread exit, hands the unused blocks back to the heap and lets the last block in flight delete the pool.
+      void Close() noexcept
+      {
+        for (std::size_t i = 0; i < BlockSizeCount; ++i)
+        {
+          FreeList(m_free[i]);
+          m_free[i] = nullptr;
+          FreeList(m_remoteFree[i].exchange(ClosedList(), std::memory_order_acquire));
+        }
+        GetThreadPool().pPool = nullptr;
+        Release();
+      }
+
+      static void FreeList(Block* pBlock) noexcept
+      {
+        while (pBlock != nullptr)
+        {
+          Block* const pNext = pBlock->pNext;
+          FreeBlock(pBlock);
+          pBlock = pNext;
+        }
+      }
+
+      void PushRemote(Block* const pBlock, const std::size_t index) noexcept
+      {
+        Block* pHead = m_remoteFree[index].load(std::memory_order_relaxed);
+        do
+        {
+          if (pHead == ClosedList())
+          {
+            FreeBlock(pBlock);
+            return;
+          }
+          pBlock->pNext = pHead;
+        } while (!m_remoteFree[index].compare_exchange_weak(pHead, pBlock, std::memory_order_release, std::memory_order_relaxed));
+      }
+
+      void* AllocateBlock(const std::size_t index)
+      {
+        Block* pBlock = m_free[index];
+        if (pBlock == nullptr)
+        {
+          pBlock = m_remoteFree[index].exchange(nullptr, std::memory_order_acquire);
+        }
+
+        if (pBlock != nullptr)
+        {
+          m_free[index] = pBlock->pNext;
+        }
+        else
+        {
+          pBlock = new (::operator new(sizeof(Block) + (SmallestBlockSize << index))) Block{this};
+          m_referenceCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        return pBlock + 1;
+      }
+
+      FramePool() = default;
+      ~FramePool() = default;
+
+    public:
+      FramePool(const FramePool&) = delete;
+      FramePool& operator=(const FramePool&) = delete;
+
+      /// @brief Allocates from the calling thread's pool, with the alignment of the default operator new.
+      static void* Allocate(const std::size_t size)
+      {
+        const std::size_t index = GetBlockSizeIndex(size);
+        if (index == BlockSizeCount)
+        {
+          return new (::operator new(sizeof(Block) + size)) Block{} + 1;
+        }
+
+        ThreadPool& rThreadPool = GetThreadPool();
+        if (rThreadPool.pPool == nullptr)
+        {
+          rThreadPool.pPool = new FramePool();
+        }
+        return rThreadPool.pPool->AllocateBlock(index);
+      }
+
+      /// @brief Returns the memory to the pool that allocated it, from any thread.
+      /// @param size The size that was passed to Allocate.
+      static void Deallocate(void* const pMemory, const std::size_t size) noexcept
+      {
+        Block* const pBlock = static_cast<Block*>(pMemory) - 1;
+        FramePool* const pOwner = pBlock->pOwner;
+        if (pOwner == nullptr)
+        {
+          pBlock->~Block();
+          ::operator delete(static_cast<void*>(pBlock));
+          return;
+        }
+
+        const std::size_t index = GetBlockSizeIndex(size);
+        if (pOwner == GetThreadPool().pPool)
+        {
+          pBlock->pNext = pOwner->m_free[index];
+          pOwner->m_free[index] = pBlock;
+        }
+        else
+        {
+          pOwner->PushRemote(pBlock, index);
+        }
+      }
+    };
+
+    /// @brief Standard allocator on top of FramePool, asio uses it for the operations of an executor that requires it.
+    template <typename T>
+    class FramePoolAllocator
+    {
+    public:
+      using value_type = T;
+
+      FramePoolAllocator() noexcept = default;
+
+      template <typename TOther>
+      FramePoolAllocator(const FramePoolAllocator<TOther>& /*other*/) noexcept    // NOLINT(google-explicit-constructor)
+      {
+      }
+
+      T* allocate(const std::size_t count)
+      {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "FramePool only provides the default new alignment");
+        return static_cast<T*>(FramePool::Allocate(count * sizeof(T)));
+      }
+
+      void deallocate(T* const pMemory, const std::size_t count) noexcept
+      {
+        FramePool::Deallocate(pMemory, count * sizeof(T));
+      }
+
+      template <typename TOther>
+      bool operator==(const FramePoolAllocator<TOther>& /*other*/) const noexcept
+      {
+        return true;
+      }
+
+      template <typename TOther>
+      bool operator!=(const FramePoolAllocator<TOther>& /*other*/) const noexcept
+      {
+        return false;
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_UTIL_LATENCYHISTOGRAM_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_UTIL_LATENCYHISTOGRAM_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+namespace Test2
+{
+  namespace Util
+  {
+    /// @brief Fixed size log-linear histogram of durations with nanosecond resolution.
+    ///
+    /// Every power of two range is split into SubBucketCount linear buckets, so a recorded duration lands in a bucket whose width is
+    /// at most 1/16 of its value while the whole range up to MaxTrackable fits in a few kilobytes. Recording is a handful of integer
+    /// operations and never allocates. Durations above MaxTrackable are counted in the last bucket, GetMax() stays exact.
+    class LatencyHistogram
+    {
+    public:
+      static constexpr unsigned SubBucketBits = 4;
+      static constexpr std::uint64_t SubBucketCount = std::uint64_t{1} << SubBucketBits;
+      static constexpr unsigned MaxTrackableBits = 36;
+      /// @brief The largest duration in nanoseconds that gets its own bucket, about 68 seconds.
+      static constexpr std::uint64_t MaxTrackable = (std::uint64_t{1} << MaxTrackableBits) - 1;
+      /// @brief The 2 * SubBucketCount exact buckets followed by SubBucketCount buckets for each larger power of two.
+      static constexpr std::size_t BucketCount = ((MaxTrackableBits - SubBucketBits - 1) << SubBucketBits) + 2 * SubBucketCount;
+
+    private:
+      std::array<std::uint64_t, BucketCount> m_buckets{};
+      std::uint64_t m_count{0};
+      std::uint64_t m_max{0};
+
+      /// @brief Values below 2 * SubBucketCount map to themselves, every following power of two adds SubBucketCount buckets.
+      static constexpr std::size_t GetBucketIndex(const std::uint64_t value) noexcept
+      {
+        const unsigned width = static_cast<unsigned>(std::bit_width(value));
+        const unsigned shift = width > SubBucketBits + 1 ? width - (SubBucketBits + 1) : 0u;
+        return static_cast<std::size_t>((std::uint64_t{shift} << SubBucketBits) + (value >> shift));
+      }
+
+      /// @brief The largest value that maps to the bucket.
+      static constexpr std::uint64_t GetBucketUpperBound(const std::size_t index) noexcept
+      {
+        if (index < 2 * SubBucketCount)
+        {
+          return index;
+        }
+        const std::uint64_t shift = (index >> SubBucketBits) - 1;
+        const std::uint64_t lowerBound = (index - (shift << SubBucketBits)) << shift;
+        return lowerBound + (std::uint64_t{1} << shift) - 1;
+      }
+
+    public:
+      void Record(const std::chrono::nanoseconds duration) noexcept
+      {
+        static_assert(GetBucketIndex(MaxTrackable) + 1 == BucketCount);
+        const std::uint64_t value = duration.count() > 0 ? static_cast<std::uint64_t>(duration.count()) : 0u;
+        ++m_buckets[GetBucketIndex(std::min(value, MaxTrackable))];
+        ++m_count;
+        m_max = std::max(m_max, value);
+      }
+
+      void Reset() noexcept
+      {
+        m_buckets.fill(0);
+        m_count = 0;
+        m_max = 0;
+      }
+
+      [[nodiscard]] std::uint64_t GetCount() const noexcept
+      {
+        return m_count;
+      }
+
+      [[nodiscard]] std::chrono::nanoseconds GetMax() const noexcept
+      {
+        return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(m_max));
+      }
+
+      /// @brief Get the duration that the given fraction of the recorded durations did not exceed.
+      ///
+      /// The result is the upper bound of the bucket the percentile falls in, capped to GetMax(), so it overestimates by less than one
+      /// bucket width (1/16 of the value).
+      ///
+      /// @param percentile The percentile in the range [0, 100], values outside are clamped.
+      /// @return The duration, zero if nothing was recorded.
+      [[nodiscard]] std::chrono::nanoseconds GetPercentile(const double percentile) const noexcept
+      {
+        if (m_count == 0)
+        {
+          return std::chrono::nanoseconds::zero();
+        }
+
+        // The rank of the sample we are looking for, counted from one
+        const double fraction = std::clamp(percentile, 0.0, 100.0) / 100.0;
+        const auto rank = std::max(std::uint64_t{1}, static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(m_count))));
+        std::uint64_t seen = 0;
+        for (std::size_t index = 0; index < BucketCount; ++index)
+        {
+          seen += m_buckets[index];
+          if (seen >= rank)
+          {
+            return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(std::min(GetBucketUpperBound(index), m_max)));
+          }
+        }
+        return GetMax();
+      }
+    };
+  }
+}
+
+#endif
@@ -37,6 +37,12 @@ namespace Test2
       return std::span<const std::type_index>(interfaces);
     }
 
+    std::span<const ServiceIdBinding> GetSupportedServiceIds() const override
+    {
+      static const ServiceIdBinding bindings[] = {MakeServiceIdBinding<IAddService>()};
+      return std::span<const ServiceIdBinding>(bindings);
+    }
+
     std::shared_ptr<IServiceControl> Create(const std::type_index& type, const ServiceCreateInfo& createInfo) override
     {
       if (type == std::type_index(typeid(IAddService)))
@@ -14,7 +14,10 @@
 //****************************************************************************************************************************************************
 
 #include <Test2/Framework/Service/IService.hpp>
+#include <Test2/Services/ServiceIds.hpp>
 #include <boost/asio/awaitable.hpp>
+#include <span>
+#include <vector>
 
 namespace Test2
 {
@@ -22,6 +25,8 @@ namespace Test2
   class IAddService : public IService
   {
   public:
+    static constexpr ServiceId Id = ServiceIds::Add;
+
     ~IAddService() override = default;
 
     /// @brief Asynchronously adds two numbers.
@@ -29,6 +34,14 @@ namespace Test2
     /// @param b The second operand.
     /// @return An awaitable yielding the sum of a and b.
     virtual boost::asio::awaitable<double> AddAsync(double a, double b) = 0;
+
+    /// @brief Asynchronously adds many pairs of numbers in one call, the result element i is a[i] + b[i].
+    /// @param a The left operands.
+    /// @param b The right operands, must have the same size as a.
+    /// @return An awaitable yielding the sums.
+    /// @throws std::invalid_argument if a and b differ in size.
+    /// @note The spans are read while the call runs, so the data must stay valid until the awaitable completes.
+    virtual boost::asio::awaitable<std::vector<double>> AddManyAsync(std::span<const double> a, std::span<const double> b) = 0;
   };
 
 }
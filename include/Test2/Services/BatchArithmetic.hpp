@@ -0,0 +1,65 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_SERVICES_BATCHARITHMETIC_HPP
+#define SERVICE_FRAMEWORK_TEST2_SERVICES_BATCHARITHMETIC_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <fmt/format.h>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace Test2
+{
+  namespace BatchArithmetic
+  {
+    /// @brief Validates the operand spans of a batch call, so services can reject a bad request before doing any work.
+    /// @throws std::invalid_argument if the spans differ in size.
+    inline void ValidateOperands(const std::span<const double> a, const std::span<const double> b)
+    {
+      if (a.size() != b.size())
+      {
+        throw std::invalid_argument(fmt::format("Batch operands differ in size: {} and {}", a.size(), b.size()));
+      }
+    }
+
+    /// @brief Applies a binary operation to every pair of elements.
+    ///
+    /// The loop only reads the operand spans and writes the freshly allocated result through plain pointers, with no calls or
+    /// branches inside, so the compiler can vectorize it.
+    ///
+    /// @param a The left operands.
+    /// @param b The right operands, must have the same size as a.
+    /// @param operation The operation, called as operation(a[i], b[i]).
+    /// @return The results, in the order of the operands.
+    /// @throws std::invalid_argument if the spans differ in size.
+    template <typename Operation>
+    std::vector<double> Apply(const std::span<const double> a, const std::span<const double> b, Operation operation)
+    {
+      ValidateOperands(a, b);
+
+      std::vector<double> result(a.size());
+      const std::size_t count = a.size();
+      const double* pA = a.data();
+      const double* pB = b.data();
+      double* pResult = result.data();
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        pResult[i] = operation(pA[i], pB[i]);
+      }
+      return result;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_SERVICES_CALCULATOR_CALCULATOREVALUATIONMODE_HPP
+#define SERVICE_FRAMEWORK_TEST2_SERVICES_CALCULATOR_CALCULATOREVALUATIONMODE_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+namespace Test2
+{
+  /// @brief Controls how CalculatorService issues the arithmetic service calls of an expression.
+  enum class CalculatorEvaluationMode
+  {
+    /// @brief One call at a time, in left to right order.
+    Sequential = 0,
+
+    /// @brief Operators whose operands do not depend on each other are issued concurrently and awaited jointly,
+    ///        so the latency follows the depth of the expression tree instead of the number of operators.
+    ///        When an operand fails the first error is rethrown after both operands finished.
+    Concurrent = 1
+  };
+}
+
+#endif
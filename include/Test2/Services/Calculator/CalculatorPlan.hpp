@@ -0,0 +1,450 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_SERVICES_CALCULATOR_CALCULATORPLAN_HPP
+#define SERVICE_FRAMEWORK_TEST2_SERVICES_CALCULATOR_CALCULATORPLAN_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Test2
+{
+  /// @brief The operations a compiled calculator expression is made of.
+  enum class CalculatorOpCode : std::uint8_t
+  {
+    /// @brief Push the instruction's constant.
+    Push = 0,
+    /// @brief Pop the right and left operand and push their sum.
+    Add = 1,
+    /// @brief Pop the right and left operand and push their difference.
+    Subtract = 2,
+    /// @brief Pop the right and left operand and push their product.
+    Multiply = 3,
+    /// @brief Pop the right and left operand and push their quotient.
+    Divide = 4,
+    /// @brief Push the result of an earlier operator, used in place of a repeated sub-expression.
+    Load = 5,
+    /// @brief Push the value bound to a variable.
+    Variable = 6
+  };
+
+  struct CalculatorInstruction
+  {
+    CalculatorOpCode OpCode{CalculatorOpCode::Push};
+    /// @brief Set on operators whose result is reused by a Load.
+    bool IsShared{false};
+    /// @brief The index of the instruction that produces the left operand of an operator, unused for Push.
+    ///        The right operand is always produced by the previous instruction.
+    ///        For Load it is the index of the operator whose result is loaded, for Variable the index of the variable.
+    std::uint32_t LeftOperand{0};
+    /// @brief The constant of a Push instruction, unused otherwise.
+    double Value{0.0};
+  };
+
+  /// @brief A calculator expression compiled to postfix stack code.
+  ///
+  /// Compiling parses the expression once, evaluating the plan then only runs the instructions. The operators appear in the order the
+  /// recursive descent parser used to evaluate them, so the arithmetic services see the same sequence of calls.
+  /// Each operator also links to its operands, which turns the instructions into the expression tree for evaluators that run
+  /// independent operators concurrently.
+  /// A sub-expression that repeats an earlier one, like the second (a * b) in (a * b) / (a * b + c), is compiled to a Load of the earlier
+  /// result, so each distinct sub-expression is only sent to the arithmetic services once per evaluation.
+  class CalculatorPlan
+  {
+    std::vector<CalculatorInstruction> m_instructions;
+    std::size_t m_maxStackDepth{0};
+    bool m_hasSharedResults{false};
+
+    /// @brief Identifies an operator by its opcode and the value numbers of its operands.
+    struct OperatorKey
+    {
+      CalculatorOpCode OpCode;
+      std::uint32_t Left;
+      std::uint32_t Right;
+
+      bool operator==(const OperatorKey&) const noexcept = default;
+    };
+
+    struct OperatorKeyHash
+    {
+      std::size_t operator()(const OperatorKey& key) const noexcept
+      {
+        const std::uint64_t operands = (static_cast<std::uint64_t>(key.Left) << 32) | key.Right;
+        return std::hash<std::uint64_t>{}(operands) ^ static_cast<std::size_t>(key.OpCode);
+      }
+    };
+
+    /// @brief The value number and instruction index of the first occurrence of a sub-expression.
+    struct ValueEntry
+    {
+      std::uint32_t ValueNumber;
+      std::uint32_t Index;
+    };
+
+    /// @brief Parser context, local to each compilation. Views the expression, which must outlive the compilation.
+    struct ParserContext
+    {
+      std::string_view expression;
+      std::span<const std::string_view> variables;
+      size_t position;
+      std::vector<CalculatorInstruction> instructions;
+      /// @brief The first instruction of the subtree each instruction completes.
+      std::vector<std::uint32_t> subtreeStarts;
+      /// @brief Equal sub-expressions get equal value numbers.
+      std::vector<std::uint32_t> valueNumbers;
+      std::unordered_map<std::uint64_t, std::uint32_t> constantValueNumbers;
+      std::unordered_map<OperatorKey, ValueEntry, OperatorKeyHash> operatorValues;
+      /// @brief Value numbers below the variable count are the variables.
+      std::uint32_t nextValueNumber{0};
+      std::size_t stackDepth{0};
+      std::size_t maxStackDepth{0};
+      /// @brief The number of parentheses the parser is currently inside.
+      std::size_t nestingDepth{0};
+
+      ParserContext(const std::string_view expr, const std::span<const std::string_view> vars)
+        : expression(expr)
+        , variables(vars)
+        , position(0)
+        , nextValueNumber(static_cast<std::uint32_t>(vars.size()))
+      {
+      }
+
+      void skipWhitespace()
+      {
+        while (position < expression.length() && std::isspace(static_cast<unsigned char>(expression[position])))
+        {
+          position++;
+        }
+      }
+
+      char peek()
+      {
+        skipWhitespace();
+        if (position >= expression.length())
+        {
+          return '\0';
+        }
+        return expression[position];
+      }
+
+      char consume()
+      {
+        skipWhitespace();
+        if (position >= expression.length())
+        {
+          return '\0';
+        }
+        return expression[position++];
+      }
+
+      void emitPush(const double value)
+      {
+        const auto [itr, inserted] = constantValueNumbers.try_emplace(std::bit_cast<std::uint64_t>(value), nextValueNumber);
+        if (inserted)
+        {
+          ++nextValueNumber;
+        }
+        subtreeStarts.push_back(static_cast<std::uint32_t>(instructions.size()));
+        valueNumbers.push_back(itr->second);
+        instructions.push_back(CalculatorInstruction{CalculatorOpCode::Push, false, 0, value});
+        ++stackDepth;
+        maxStackDepth = std::max(maxStackDepth, stackDepth);
+      }
+
+      void emitVariable(const std::uint32_t variableIndex)
+      {
+        subtreeStarts.push_back(static_cast<std::uint32_t>(instructions.size()));
+        valueNumbers.push_back(variableIndex);
+        instructions.push_back(CalculatorInstruction{CalculatorOpCode::Variable, false, variableIndex, 0.0});
+        ++stackDepth;
+        maxStackDepth = std::max(maxStackDepth, stackDepth);
+      }
+
+      void emitOperator(const CalculatorOpCode opCode)
+      {
+        const auto rightOperand = static_cast<std::uint32_t>(instructions.size() - 1);
+        const std::uint32_t leftOperand = subtreeStarts[rightOperand] - 1;
+        const std::uint32_t subtreeStart = subtreeStarts[leftOperand];
+        --stackDepth;
+
+        const OperatorKey key{opCode, valueNumbers[leftOperand], valueNumbers[rightOperand]};
+        if (const auto itr = operatorValues.find(key); itr != operatorValues.end())
+        {
+          // The operands were compiled bottom up, so a repeated sub-expression only contains constants and loads at this point.
+          // Replace all of it with a load of the first occurrence.
+          const ValueEntry entry = itr->second;
+          instructions.resize(subtreeStart);
+          subtreeStarts.resize(subtreeStart);
+          valueNumbers.resize(subtreeStart);
+          subtreeStarts.push_back(subtreeStart);
+          valueNumbers.push_back(entry.ValueNumber);
+          instructions.push_back(CalculatorInstruction{CalculatorOpCode::Load, false, entry.Index, 0.0});
+          return;
+        }
+
+        const auto index = static_cast<std::uint32_t>(instructions.size());
+        operatorValues.emplace(key, ValueEntry{nextValueNumber, index});
+        subtreeStarts.push_back(subtreeStart);
+        valueNumbers.push_back(nextValueNumber++);
+        instructions.push_back(CalculatorInstruction{opCode, false, leftOperand, 0.0});
+      }
+
+      static bool isDigit(char c)
+      {
+        return c >= '0' && c <= '9';
+      }
+
+      static bool isIdentifierStart(char c)
+      {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+      }
+    };
+
+    /// @brief Parse a number from the expression.
+    ///
+    /// The digits are converted in place with std::from_chars, which neither allocates nor depends on the locale.
+    static void parseNumber(ParserContext& ctx)
+    {
+      ctx.skipWhitespace();
+      bool hasDecimal = false;
+      bool isNegative = false;
+
+      // Handle negative numbers
+      if (ctx.peek() == '-')
+      {
+        isNegative = true;
+        ctx.consume();
+      }
+
+      // Only plain decimal digits with at most one point, from_chars on its own would also accept exponents, inf and nan
+      const std::size_t start = ctx.position;
+      while (ctx.position < ctx.expression.length())
+      {
+        const char c = ctx.expression[ctx.position];
+        if (ParserContext::isDigit(c))
+        {
+          ctx.position++;
+        }
+        else if (c == '.' && !hasDecimal)
+        {
+          hasDecimal = true;
+          ctx.position++;
+        }
+        else
+        {
+          break;
+        }
+      }
+
+      const std::string_view digits = ctx.expression.substr(start, ctx.position - start);
+      if (digits.empty() || digits == ".")
+      {
+        throw std::invalid_argument("Invalid number format at position " + std::to_string(ctx.position));
+      }
+
+      double value = 0.0;
+      const std::from_chars_result result = std::from_chars(digits.data(), digits.data() + digits.size(), value, std::chars_format::fixed);
+      if (result.ec == std::errc::result_out_of_range)
+      {
+        throw std::invalid_argument("Number out of range at position " + std::to_string(start));
+      }
+      if (isNegative)
+      {
+        value = -value;
+      }
+      ctx.emitPush(value);
+    }
+
+    /// @brief Parse a variable name, which must be one of the variables given to Compile.
+    static void parseVariable(ParserContext& ctx)
+    {
+      ctx.skipWhitespace();
+      const std::size_t start = ctx.position;
+      while (ctx.position < ctx.expression.length() &&
+             (ParserContext::isIdentifierStart(ctx.expression[ctx.position]) || ParserContext::isDigit(ctx.expression[ctx.position])))
+      {
+        ctx.position++;
+      }
+
+      const std::string_view name = ctx.expression.substr(start, ctx.position - start);
+      const auto itr = std::find(ctx.variables.begin(), ctx.variables.end(), name);
+      if (itr == ctx.variables.end())
+      {
+        throw std::invalid_argument("Unknown variable: " + std::string(name));
+      }
+      ctx.emitVariable(static_cast<std::uint32_t>(itr - ctx.variables.begin()));
+    }
+
+    /// @brief Parse primary expression: number, variable or (expression).
+    static void parsePrimary(ParserContext& ctx)
+    {
+      char c = ctx.peek();
+
+      if (c == '(')
+      {
+        ctx.consume();    // consume '('
+        if (++ctx.nestingDepth > MaxNestingDepth)
+        {
+          throw std::invalid_argument("Parentheses nested deeper than " + std::to_string(MaxNestingDepth) + " at position " +
+                                      std::to_string(ctx.position - 1));
+        }
+        parseExpression(ctx);
+        if (ctx.consume() != ')')
+        {
+          throw std::invalid_argument("Missing closing parenthesis");
+        }
+        --ctx.nestingDepth;
+      }
+      else if (ParserContext::isDigit(c) || c == '.' || c == '-')
+      {
+        parseNumber(ctx);
+      }
+      else if (ParserContext::isIdentifierStart(c))
+      {
+        parseVariable(ctx);
+      }
+      else
+      {
+        throw std::invalid_argument(std::string("Unexpected character: ") + c);
+      }
+    }
+
+    /// @brief Parse multiplication and division (higher precedence).
+    static void parseTerm(ParserContext& ctx)
+    {
+      parsePrimary(ctx);
+
+      while (true)
+      {
+        char op = ctx.peek();
+        if (op == '*')
+        {
+          ctx.consume();
+          parsePrimary(ctx);
+          ctx.emitOperator(CalculatorOpCode::Multiply);
+        }
+        else if (op == '/')
+        {
+          ctx.consume();
+          parsePrimary(ctx);
+          ctx.emitOperator(CalculatorOpCode::Divide);
+        }
+        else
+        {
+          break;
+        }
+      }
+    }
+
+    /// @brief Parse addition and subtraction (lower precedence).
+    static void parseExpression(ParserContext& ctx)
+    {
+      parseTerm(ctx);
+
+      while (true)
+      {
+        char op = ctx.peek();
+        if (op == '+')
+        {
+          ctx.consume();
+          parseTerm(ctx);
+          ctx.emitOperator(CalculatorOpCode::Add);
+        }
+        else if (op == '-')
+        {
+          ctx.consume();
+          parseTerm(ctx);
+          ctx.emitOperator(CalculatorOpCode::Subtract);
+        }
+        else
+        {
+          break;
+        }
+      }
+    }
+
+    CalculatorPlan(std::vector<CalculatorInstruction> instructions, const std::size_t maxStackDepth, const bool hasSharedResults) noexcept
+      : m_instructions(std::move(instructions))
+      , m_maxStackDepth(maxStackDepth)
+      , m_hasSharedResults(hasSharedResults)
+    {
+    }
+
+  public:
+    /// @brief The deepest parenthesis nesting Compile accepts. Every level recurses through the parser, so the limit keeps hostile input
+    ///        from overflowing the stack.
+    static constexpr std::size_t MaxNestingDepth = 512;
+
+    /// @brief Compiles a mathematical expression.
+    /// @param expression The expression, supports +, -, *, /, parentheses, and proper operator precedence.
+    /// @param variables The variable names the expression may use, their values are bound when the plan is evaluated.
+    /// @return The compiled plan.
+    /// @throws std::invalid_argument if the expression is malformed, uses an undeclared variable or nests parentheses deeper than
+    ///         MaxNestingDepth.
+    static CalculatorPlan Compile(const std::string_view expression, const std::span<const std::string_view> variables = {})
+    {
+      ParserContext ctx(expression, variables);
+      parseExpression(ctx);
+
+      // Check if we consumed the entire expression
+      ctx.skipWhitespace();
+      if (ctx.position < ctx.expression.length())
+      {
+        throw std::invalid_argument("Unexpected characters at end of expression at position " + std::to_string(ctx.position));
+      }
+
+      // Flagged once all loads are known, a load can itself be replaced by a load of a larger sub-expression
+      bool hasSharedResults = false;
+      for (const CalculatorInstruction& instruction : ctx.instructions)
+      {
+        if (instruction.OpCode == CalculatorOpCode::Load)
+        {
+          ctx.instructions[instruction.LeftOperand].IsShared = true;
+          hasSharedResults = true;
+        }
+      }
+      return CalculatorPlan(std::move(ctx.instructions), ctx.maxStackDepth, hasSharedResults);
+    }
+
+    /// @brief Get the instructions in execution order.
+    [[nodiscard]] std::span<const CalculatorInstruction> GetInstructions() const noexcept
+    {
+      return m_instructions;
+    }
+
+    /// @brief Get the largest number of values on the stack while the plan runs, an upper bound when sub-expressions were shared.
+    [[nodiscard]] std::size_t GetMaxStackDepth() const noexcept
+    {
+      return m_maxStackDepth;
+    }
+
+    /// @brief Check if any operator result is reused by a Load, evaluators only need to keep results around when it is.
+    [[nodiscard]] bool HasSharedResults() const noexcept
+    {
+      return m_hasSharedResults;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_SERVICES_CALCULATOR_CALCULATORPLANCACHE_HPP
+#define SERVICE_FRAMEWORK_TEST2_SERVICES_CALCULATOR_CALCULATORPLANCACHE_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <Test2/Services/Calculator/CalculatorPlan.hpp>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace Test2
+{
+  /// @brief Least recently used cache of compiled calculator plans, keyed by the exact expression text.
+  ///
+  /// Plans are handed out as shared pointers, so an evaluation that is suspended in a service call keeps its plan alive even if the plan
+  /// is evicted meanwhile. Not thread safe, the owning service only uses it from its own thread.
+  class CalculatorPlanCache
+  {
+    struct StringHash
+    {
+      using is_transparent = void;
+
+      std::size_t operator()(const std::string_view value) const noexcept
+      {
+        return std::hash<std::string_view>{}(value);
+      }
+    };
+
+    struct Entry
+    {
+      std::string Expression;
+      std::shared_ptr<const CalculatorPlan> Plan;
+    };
+
+    std::size_t m_capacity;
+    /// @brief Most recently used first.
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string_view, std::list<Entry>::iterator, StringHash, std::equal_to<>> m_index;
+    std::uint64_t m_hitCount{0};
+    std::uint64_t m_missCount{0};
+
+  public:
+    /// @param capacity The maximum number of plans kept, zero disables caching.
+    explicit CalculatorPlanCache(const std::size_t capacity)
+      : m_capacity(capacity)
+    {
+      m_index.reserve(capacity);
+    }
+
+    CalculatorPlanCache(const CalculatorPlanCache&) = delete;
+    CalculatorPlanCache& operator=(const CalculatorPlanCache&) = delete;
+
+    /// @brief Get the cached plan for the expression, compiling and caching it on a miss.
+    /// @throws std::invalid_argument if the expression is malformed, malformed expressions are not cached.
+    std::shared_ptr<const CalculatorPlan> GetOrCompile(const std::string_view expression)
+    {
+      if (auto itr = m_index.find(expression); itr != m_index.end())
+      {
+        ++m_hitCount;
+        m_entries.splice(m_entries.begin(), m_entries, itr->second);
+        return itr->second->Plan;
+      }
+
+      ++m_missCount;
+      auto plan = std::make_shared<const CalculatorPlan>(CalculatorPlan::Compile(expression));
+      if (m_capacity == 0)
+      {
+        return plan;
+      }
+
+      if (m_entries.size() >= m_capacity)
+      {
+        m_index.erase(m_entries.back().Expression);
+        m_entries.pop_back();
+      }
+      // The index keys view the expression stored in the list node, which does not move
+      m_entries.push_front(Entry{std::string(expression), plan});
+      m_index.emplace(m_entries.front().Expression, m_entries.begin());
+      return plan;
+    }
+
+    [[nodiscard]] std::size_t GetSize() const noexcept
+    {
+      return m_entries.size();
+    }
+
+    [[nodiscard]] std::size_t GetCapacity() const noexcept
+    {
+      return m_capacity;
+    }
+
+    [[nodiscard]] std::uint64_t GetHitCount() const noexcept
+    {
+      return m_hitCount;
+    }
+
+    [[nodiscard]] std::uint64_t GetMissCount() const noexcept
+    {
+      return m_missCount;
+    }
+  };
+}
+
+#endif
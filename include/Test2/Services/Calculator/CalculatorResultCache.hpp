@@ -0,0 +1,145 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_SERVICES_CALCULATOR_CALCULATORRESULTCACHE_HPP
+#define SERVICE_FRAMEWORK_TEST2_SERVICES_CALCULATOR_CALCULATORRESULTCACHE_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Test2
+{
+  /// @brief Bounded cache of expression results, keyed by the exact expression text.
+  ///
+  /// Evicts with the CLOCK algorithm: a hit only sets the entry's referenced bit, and a full cache sweeps its slots in a circle, clearing
+  /// referenced bits until it finds an entry that was not used since the last sweep. Unlike the plan cache a hit never reorders
+  /// anything, which keeps the hot path to one hash lookup.
+  /// Only correct while the arithmetic services are pure functions of their arguments. Not thread safe, the owning service only uses it
+  /// from its own thread.
+  class CalculatorResultCache
+  {
+    struct StringHash
+    {
+      using is_transparent = void;
+
+      std::size_t operator()(const std::string_view value) const noexcept
+      {
+        return std::hash<std::string_view>{}(value);
+      }
+    };
+
+    struct Slot
+    {
+      std::string Expression;
+      double Result{0.0};
+      bool IsReferenced{false};
+    };
+
+    std::size_t m_capacity;
+    /// @brief Reserved up front and never grown past the capacity, so the index keys that view the slot strings stay valid.
+    std::vector<Slot> m_slots;
+    std::unordered_map<std::string_view, std::size_t, StringHash, std::equal_to<>> m_index;
+    std::size_t m_hand{0};
+    std::uint64_t m_hitCount{0};
+    std::uint64_t m_missCount{0};
+
+  public:
+    /// @param capacity The maximum number of results kept, zero disables caching.
+    explicit CalculatorResultCache(const std::size_t capacity)
+      : m_capacity(capacity)
+    {
+      m_slots.reserve(capacity);
+      m_index.reserve(capacity);
+    }
+
+    CalculatorResultCache(const CalculatorResultCache&) = delete;
+    CalculatorResultCache& operator=(const CalculatorResultCache&) = delete;
+
+    /// @brief Look up the cached result of the expression.
+    [[nodiscard]] std::optional<double> TryGet(const std::string_view expression)
+    {
+      if (const auto itr = m_index.find(expression); itr != m_index.end())
+      {
+        ++m_hitCount;
+        Slot& rSlot = m_slots[itr->second];
+        rSlot.IsReferenced = true;
+        return rSlot.Result;
+      }
+      ++m_missCount;
+      return std::nullopt;
+    }
+
+    /// @brief Cache the result of the expression, replacing any result already cached for it.
+    void Insert(const std::string_view expression, const double result)
+    {
+      if (m_capacity == 0)
+      {
+        return;
+      }
+      if (const auto itr = m_index.find(expression); itr != m_index.end())
+      {
+        m_slots[itr->second].Result = result;
+        return;
+      }
+
+      std::size_t slotIndex = m_slots.size();
+      if (slotIndex < m_capacity)
+      {
+        m_slots.push_back(Slot{std::string(expression), result, false});
+      }
+      else
+      {
+        while (m_slots[m_hand].IsReferenced)
+        {
+          m_slots[m_hand].IsReferenced = false;
+          m_hand = (m_hand + 1) % m_capacity;
+        }
+        slotIndex = m_hand;
+        m_hand = (m_hand + 1) % m_capacity;
+
+        Slot& rSlot = m_slots[slotIndex];
+        m_index.erase(rSlot.Expression);
+        rSlot.Expression.assign(expression);
+        rSlot.Result = result;
+      }
+      m_index.emplace(m_slots[slotIndex].Expression, slotIndex);
+    }
+
+    [[nodiscard]] std::size_t GetSize() const noexcept
+    {
+      return m_slots.size();
+    }
+
+    [[nodiscard]] std::size_t GetCapacity() const noexcept
+    {
+      return m_capacity;
+    }
+
+    [[nodiscard]] std::uint64_t GetHitCount() const noexcept
+    {
+      return m_hitCount;
+    }
+
+    [[nodiscard]] std::uint64_t GetMissCount() const noexcept
+    {
+      return m_missCount;
+    }
+  };
+}
+
+#endif
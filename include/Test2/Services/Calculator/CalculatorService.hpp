@@ -18,22 +18,44 @@
 #include <Test2/Framework/Service/ServiceCreateInfo.hpp>
 #include <Test2/Framework/Service/ServiceInitResult.hpp>
 #include <Test2/Framework/Service/ServiceShutdownResult.hpp>
+#include <Test2/Framework/Util/AsyncSignal.hpp>
 #include <Test2/Services/Add/IAddService.hpp>
+#include <Test2/Services/Calculator/CalculatorEvaluationMode.hpp>
+#include <Test2/Services/Calculator/CalculatorPlan.hpp>
+#include <Test2/Services/Calculator/CalculatorPlanCache.hpp>
+#include <Test2/Services/Calculator/CalculatorResultCache.hpp>
 #include <Test2/Services/Calculator/ICalculatorService.hpp>
 #include <Test2/Services/Divide/IDivideService.hpp>
 #include <Test2/Services/Multiply/IMultiplyService.hpp>
+#include <Test2/Services/ServiceConfig.hpp>
 #include <Test2/Services/Subtract/ISubtractService.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <spdlog/spdlog.h>
-#include <cctype>
+#include <cstddef>
+#include <exception>
 #include <memory>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace Test2
 {
   /// @brief Calculator Service - parses and evaluates math expressions.
   ///
-  /// Supports +, -, *, /, parentheses, and proper operator precedence.
+  /// Supports +, -, *, /, parentheses, and proper operator precedence. Expressions are compiled to a CalculatorPlan once and the plans
+  /// of recently used expressions are cached. The results of recently evaluated expressions can be cached as well, so a repeated
+  /// expression makes no arithmetic service calls at all, the result cache is disabled unless a capacity is given. By default the arithmetic calls are issued one at a time in left to right order, the
+  /// Concurrent CalculatorEvaluationMode overlaps independent operators instead.
+  /// An expression over a column of variable values is evaluated with the batch operations of the arithmetic services.
   /// Uses dependency injection to acquire the math services via ServiceProvider.
   class CalculatorService final
     : public ASyncServiceBase
@@ -45,200 +67,320 @@ namespace Test2
     std::shared_ptr<ISubtractService> m_subtractService;
     std::shared_ptr<IDivideService> m_divideService;
 
-    /// @brief Parser context - local to each evaluation to support concurrent calls.
-    struct ParserContext
+    CalculatorEvaluationMode m_evaluationMode;
+    CalculatorPlanCache m_planCache{Config::CALCULATOR_PLAN_CACHE_CAPACITY};
+    CalculatorResultCache m_resultCache;
+
+    /// @brief The results of shared operators during one evaluation, indexed by instruction.
+    struct SharedResults
     {
-      std::string expression;
-      size_t position;
+      std::vector<double> Values;
+      /// @brief Concurrent evaluation only, set once the operator's value has been stored so Loads can wait for it.
+      std::vector<std::optional<Util::AsyncSignal>> Ready;
+    };
 
-      explicit ParserContext(std::string expr)
-        : expression(std::move(expr))
-        , position(0)
+    /// @brief Calls the arithmetic service of an operator.
+    ///
+    /// Not a coroutine itself, it hands back the service's own awaitable so a call costs one coroutine frame instead of two.
+    boost::asio::awaitable<double> applyOperator(const CalculatorOpCode opCode, const double left, const double right)
+    {
+      switch (opCode)
       {
+      case CalculatorOpCode::Add:
+        return m_addService->AddAsync(left, right);
+      case CalculatorOpCode::Subtract:
+        return m_subtractService->SubtractAsync(left, right);
+      case CalculatorOpCode::Multiply:
+        return m_multiplyService->MultiplyAsync(left, right);
+      case CalculatorOpCode::Divide:
+        return m_divideService->DivideAsync(left, right);
+      default:
+        break;
       }
+      throw std::logic_error("Unknown calculator instruction");
+    }
 
-      void skipWhitespace()
+    /// @brief Calls the batch operation of an operator's arithmetic service, returning its awaitable like applyOperator.
+    boost::asio::awaitable<std::vector<double>> applyOperatorMany(const CalculatorOpCode opCode, const std::span<const double> left,
+                                                                  const std::span<const double> right)
+    {
+      switch (opCode)
       {
-        while (position < expression.length() && std::isspace(static_cast<unsigned char>(expression[position])))
-        {
-          position++;
-        }
+      case CalculatorOpCode::Add:
+        return m_addService->AddManyAsync(left, right);
+      case CalculatorOpCode::Subtract:
+        return m_subtractService->SubtractManyAsync(left, right);
+      case CalculatorOpCode::Multiply:
+        return m_multiplyService->MultiplyManyAsync(left, right);
+      case CalculatorOpCode::Divide:
+        return m_divideService->DivideManyAsync(left, right);
+      default:
+        break;
       }
+      throw std::logic_error("Unknown calculator instruction");
+    }
+
+    /// @brief Runs a compiled plan over a column of values for its single variable, each value on the stack is a whole column.
+    boost::asio::awaitable<std::vector<double>> evaluatePlanColumns(const CalculatorPlan& plan, const std::span<const double> values)
+    {
+      const std::span<const CalculatorInstruction> instructions = plan.GetInstructions();
+      std::vector<std::vector<double>> stack;
+      stack.reserve(plan.GetMaxStackDepth());
+      std::vector<std::vector<double>> sharedColumns(plan.HasSharedResults() ? instructions.size() : 0);
 
-      char peek()
+      for (std::size_t index = 0; index < instructions.size(); ++index)
       {
-        skipWhitespace();
-        if (position >= expression.length())
+        const CalculatorInstruction& instruction = instructions[index];
+        switch (instruction.OpCode)
         {
-          return '\0';
+        case CalculatorOpCode::Push:
+          stack.emplace_back(values.size(), instruction.Value);
+          continue;
+        case CalculatorOpCode::Variable:
+          stack.emplace_back(values.begin(), values.end());
+          continue;
+        case CalculatorOpCode::Load:
+          stack.push_back(sharedColumns[instruction.LeftOperand]);
+          continue;
+        default:
+          break;
         }
-        return expression[position];
-      }
 
-      char consume()
-      {
-        skipWhitespace();
-        if (position >= expression.length())
+        const std::vector<double> right = std::move(stack.back());
+        stack.pop_back();
+        std::vector<double> result = co_await applyOperatorMany(instruction.OpCode, stack.back(), right);
+        if (instruction.IsShared)
         {
-          return '\0';
+          sharedColumns[index] = result;
         }
-        return expression[position++];
+        stack.back() = std::move(result);
       }
 
-      static bool isDigit(char c)
-      {
-        return c >= '0' && c <= '9';
-      }
-    };
+      co_return std::move(stack.back());
+    }
 
-    /// @brief Parse a number from the expression.
-    boost::asio::awaitable<double> parseNumber(ParserContext& ctx)
+    /// @brief Runs a compiled plan, calling the arithmetic services for each operator.
+    boost::asio::awaitable<double> evaluatePlan(const CalculatorPlan& plan)
     {
-      ctx.skipWhitespace();
-      std::string numStr;
-      bool hasDecimal = false;
-      bool isNegative = false;
+      const std::span<const CalculatorInstruction> instructions = plan.GetInstructions();
+      std::vector<double> stack;
+      stack.reserve(plan.GetMaxStackDepth());
+      std::vector<double> sharedResults(plan.HasSharedResults() ? instructions.size() : 0);
 
-      // Handle negative numbers
-      if (ctx.peek() == '-')
+      for (std::size_t index = 0; index < instructions.size(); ++index)
       {
-        isNegative = true;
-        ctx.consume();
-      }
-
-      while (ctx.position < ctx.expression.length())
-      {
-        char c = ctx.expression[ctx.position];
-        if (ParserContext::isDigit(c))
+        const CalculatorInstruction& instruction = instructions[index];
+        if (instruction.OpCode == CalculatorOpCode::Push)
         {
-          numStr += c;
-          ctx.position++;
+          stack.push_back(instruction.Value);
+          continue;
         }
-        else if (c == '.' && !hasDecimal)
+        if (instruction.OpCode == CalculatorOpCode::Load)
         {
-          hasDecimal = true;
-          numStr += c;
-          ctx.position++;
-        }
-        else if (std::isspace(static_cast<unsigned char>(c)))
-        {
-          ctx.position++;
-          break;
+          stack.push_back(sharedResults[instruction.LeftOperand]);
+          continue;
         }
-        else
+
+        const double right = stack.back();
+        stack.pop_back();
+        const double result = co_await applyOperator(instruction.OpCode, stack.back(), right);
+        stack.back() = result;
+        if (instruction.IsShared)
         {
-          break;
+          sharedResults[index] = result;
         }
       }
 
-      if (numStr.empty() || numStr == ".")
-      {
-        throw std::invalid_argument("Invalid number format at position " + std::to_string(ctx.position));
-      }
+      co_return stack.back();
+    }
+
+    /// @brief Tracks the spawned left operand of an operator until the operator's coroutine joins it.
+    struct OperandJoin
+    {
+      double Value{0.0};
+      std::exception_ptr Error;
+      bool IsDone{false};
+      boost::asio::steady_timer Completed;
 
-      double value = std::stod(numStr);
-      if (isNegative)
+      explicit OperandJoin(const boost::asio::any_io_executor& executor)
+        : Completed(executor, boost::asio::steady_timer::time_point::max())
       {
-        value = -value;
       }
+    };
 
+    static boost::asio::awaitable<double> constantAsync(const double value)
+    {
       co_return value;
     }
 
-    /// @brief Parse primary expression: number or (expression).
-    boost::asio::awaitable<double> parsePrimary(ParserContext& ctx)
+    /// @brief Evaluates the subtree that ends at the instruction, evaluating the two operands of an operator concurrently.
+    ///
+    /// Not a coroutine itself, so a plain operator costs the frame of evaluateOperator only.
+    boost::asio::awaitable<double> evaluateNode(const CalculatorPlan& plan, const std::size_t index, SharedResults& rShared)
     {
-      char c = ctx.peek();
-
-      if (c == '(')
+      const CalculatorInstruction& instruction = plan.GetInstructions()[index];
+      switch (instruction.OpCode)
       {
-        ctx.consume();    // consume '('
-        double result = co_await parseExpression(ctx);
-        if (ctx.consume() != ')')
-        {
-          throw std::invalid_argument("Missing closing parenthesis");
-        }
-        co_return result;
+      case CalculatorOpCode::Push:
+        return constantAsync(instruction.Value);
+      case CalculatorOpCode::Load:
+        return loadSharedResult(instruction.LeftOperand, rShared);
+      default:
+        break;
       }
-      else if (ParserContext::isDigit(c) || c == '.' || c == '-')
+      if (instruction.IsShared)
       {
-        co_return co_await parseNumber(ctx);
+        return evaluateSharedOperator(plan, index, rShared);
       }
-      else
+      return evaluateOperator(plan, index, rShared);
+    }
+
+    static boost::asio::awaitable<double> loadSharedResult(const std::size_t sharedIndex, SharedResults& rShared)
+    {
+      // The first occurrence always has the lower index, so it is never waiting on this load
+      co_await rShared.Ready[sharedIndex]->WaitAsync();
+      co_return rShared.Values[sharedIndex];
+    }
+
+    /// @brief Evaluates an operator whose result is loaded elsewhere in the plan, and releases the loads once it is known.
+    boost::asio::awaitable<double> evaluateSharedOperator(const CalculatorPlan& plan, const std::size_t index, SharedResults& rShared)
+    {
+      Util::AsyncSignal& rReady = *rShared.Ready[index];
+      try
+      {
+        const double result = co_await evaluateOperator(plan, index, rShared);
+        rShared.Values[index] = result;
+        rReady.Set();
+        co_return result;
+      }
+      catch (...)
       {
-        throw std::invalid_argument(std::string("Unexpected character: ") + c);
+        rReady.SetException(std::current_exception());
+        throw;
       }
     }
 
-    /// @brief Parse multiplication and division (higher precedence).
-    boost::asio::awaitable<double> parseTerm(ParserContext& ctx)
+    /// @brief Evaluates the operands of the operator at the index, then the operator itself.
+    ///
+    /// Constant operands are read directly. When both operands need service calls the left one is spawned and the right one runs
+    /// inline on this coroutine, so their calls overlap at the cost of a single spawn.
+    boost::asio::awaitable<double> evaluateOperator(const CalculatorPlan& plan, const std::size_t index, SharedResults& rShared)
     {
-      double left = co_await parsePrimary(ctx);
-
-      while (true)
+      const CalculatorInstruction& instruction = plan.GetInstructions()[index];
+      const CalculatorInstruction& leftOperand = plan.GetInstructions()[instruction.LeftOperand];
+      const CalculatorInstruction& rightOperand = plan.GetInstructions()[index - 1];
+      if (leftOperand.OpCode == CalculatorOpCode::Push)
       {
-        char op = ctx.peek();
-        if (op == '*')
-        {
-          ctx.consume();
-          double right = co_await parsePrimary(ctx);
-          left = co_await m_multiplyService->MultiplyAsync(left, right);
-        }
-        else if (op == '/')
+        double right = rightOperand.Value;
+        if (rightOperand.OpCode != CalculatorOpCode::Push)
         {
-          ctx.consume();
-          double right = co_await parsePrimary(ctx);
-          left = co_await m_divideService->DivideAsync(left, right);
-        }
-        else
-        {
-          break;
+          right = co_await evaluateNode(plan, index - 1, rShared);
         }
+        co_return co_await applyOperator(instruction.OpCode, leftOperand.Value, right);
+      }
+      if (rightOperand.OpCode == CalculatorOpCode::Push)
+      {
+        const double left = co_await evaluateNode(plan, instruction.LeftOperand, rShared);
+        co_return co_await applyOperator(instruction.OpCode, left, rightOperand.Value);
       }
 
-      co_return left;
+      // The join lives in this frame, which always waits for the spawned operand before it returns or throws
+      const auto executor = co_await boost::asio::this_coro::executor;
+      OperandJoin join(executor);
+      boost::asio::co_spawn(executor, evaluateNode(plan, instruction.LeftOperand, rShared),
+                            [&join](std::exception_ptr error, const double value)
+                            {
+                              join.Value = value;
+                              join.Error = std::move(error);
+                              join.IsDone = true;
+                              join.Completed.expires_at(boost::asio::steady_timer::time_point::min());
+                            });
+
+      double right = 0.0;
+      std::exception_ptr rightError;
+      try
+      {
+        right = co_await evaluateNode(plan, index - 1, rShared);
+      }
+      catch (...)
+      {
+        rightError = std::current_exception();
+      }
+      if (!join.IsDone)
+      {
+        boost::system::error_code ec;
+        co_await join.Completed.async_wait(boost::asio::redirect_error(boost::asio::use_awaitable, ec));
+      }
+
+      // Report the left error first, like the sequential evaluation would
+      if (join.Error)
+      {
+        std::rethrow_exception(join.Error);
+      }
+      if (rightError)
+      {
+        std::rethrow_exception(rightError);
+      }
+      co_return co_await applyOperator(instruction.OpCode, join.Value, right);
     }
 
-    /// @brief Parse addition and subtraction (lower precedence).
-    boost::asio::awaitable<double> parseExpression(ParserContext& ctx)
+    /// @brief Evaluates an expression through the result and plan caches.
+    boost::asio::awaitable<double> evaluateExpression(const std::string_view expression)
     {
-      double left = co_await parseTerm(ctx);
+      if (const std::optional<double> cachedResult = m_resultCache.TryGet(expression))
+      {
+        co_return *cachedResult;
+      }
 
-      while (true)
+      // Compiled once per distinct expression, the plan stays alive for this evaluation even if it is evicted meanwhile
+      const std::shared_ptr<const CalculatorPlan> plan = m_planCache.GetOrCompile(expression);
+      double result = 0.0;
+      if (m_evaluationMode == CalculatorEvaluationMode::Concurrent)
       {
-        char op = ctx.peek();
-        if (op == '+')
-        {
-          ctx.consume();
-          double right = co_await parseTerm(ctx);
-          left = co_await m_addService->AddAsync(left, right);
-        }
-        else if (op == '-')
+        const std::span<const CalculatorInstruction> instructions = plan->GetInstructions();
+        SharedResults shared;
+        if (plan->HasSharedResults())
         {
-          ctx.consume();
-          double right = co_await parseTerm(ctx);
-          left = co_await m_subtractService->SubtractAsync(left, right);
-        }
-        else
-        {
-          break;
+          const auto executor = co_await boost::asio::this_coro::executor;
+          shared.Values.resize(instructions.size());
+          shared.Ready.resize(instructions.size());
+          for (std::size_t index = 0; index < instructions.size(); ++index)
+          {
+            if (instructions[index].IsShared)
+            {
+              shared.Ready[index].emplace(executor);
+            }
+          }
         }
+        result = co_await evaluateNode(*plan, instructions.size() - 1, shared);
+      }
+      else
+      {
+        result = co_await evaluatePlan(*plan);
       }
 
-      co_return left;
+      // Concurrent evaluations of the same expression may both get here, the later one just refreshes the entry
+      m_resultCache.Insert(expression, result);
+      co_return result;
     }
 
   public:
     /// @brief Constructs a CalculatorService with dependencies injected via ServiceProvider.
     /// @param createInfo Contains the ServiceProvider used to acquire dependent services.
+    /// @param evaluationMode Controls if independent operators are sent to the arithmetic services concurrently.
+    /// @param resultCacheCapacity The number of expression results kept, zero disables the result cache.
     /// @throws UnknownServiceException if any required service is not found.
     /// @throws ServiceCastException if a service cannot be cast to the required type.
-    explicit CalculatorService(const ServiceCreateInfo& createInfo)
+    explicit CalculatorService(const ServiceCreateInfo& createInfo,
+                               const CalculatorEvaluationMode evaluationMode = CalculatorEvaluationMode::Sequential,
+                               const std::size_t resultCacheCapacity = Config::CALCULATOR_RESULT_CACHE_CAPACITY)
       : ASyncServiceBase(createInfo)
       , m_addService(createInfo.Provider.GetService<IAddService>())
       , m_multiplyService(createInfo.Provider.GetService<IMultiplyService>())
       , m_subtractService(createInfo.Provider.GetService<ISubtractService>())
       , m_divideService(createInfo.Provider.GetService<IDivideService>())
+      , m_evaluationMode(evaluationMode)
+      , m_resultCache(resultCacheCapacity)
     {
       spdlog::debug("CalculatorService: constructed with all dependencies");
     }
@@ -259,7 +401,13 @@ namespace Test2
 
     ProcessResult Process() override
     {
-      return ProcessResult{ProcessStatus::Idle};
+      return ProcessResult::NoSleepLimit();
+    }
+
+    ServiceTickPolicy GetTickPolicy() const override
+    {
+      // All work arrives as posted requests, there is nothing to do per tick
+      return ServiceTickPolicy::Never();
     }
 
     /// @brief Evaluates a mathematical expression asynchronously.
@@ -268,22 +416,42 @@ namespace Test2
     boost::asio::awaitable<double> EvaluateAsync(std::string expression) override
     {
       spdlog::info("[CalculatorService] Evaluating: {}", expression);
+      const double result = co_await evaluateExpression(expression);
+      spdlog::info("[CalculatorService] Result: {}", result);
+      co_return result;
+    }
 
-      // Create parser context local to this evaluation (thread-safe for concurrent calls)
-      ParserContext ctx(std::move(expression));
-
-      // Parse and evaluate
-      double result = co_await parseExpression(ctx);
+    /// @brief Evaluates many expressions one after the other, each through the result and plan caches.
+    boost::asio::awaitable<std::vector<double>> EvaluateManyAsync(const std::span<const std::string> expressions) override
+    {
+      spdlog::info("[CalculatorService] Evaluating {} expressions", expressions.size());
+      std::vector<double> results;
+      results.reserve(expressions.size());
+      for (const std::string& expression : expressions)
+      {
+        results.push_back(co_await evaluateExpression(expression));
+      }
+      co_return results;
+    }
 
-      // Check if we consumed the entire expression
-      ctx.skipWhitespace();
-      if (ctx.position < ctx.expression.length())
+    /// @brief Compiles the expression once and evaluates it column wise, one batch service call per operator.
+    boost::asio::awaitable<std::vector<double>> EvaluateManyAsync(std::string expression, std::string variable,
+                                                                  const std::span<const double> values) override
+    {
+      spdlog::info("[CalculatorService] Evaluating {} for {} values of {}", expression, values.size(), variable);
+      const std::string_view variables[] = {variable};
+      const CalculatorPlan plan = CalculatorPlan::Compile(expression, variables);
+      if (values.empty())
       {
-        throw std::invalid_argument("Unexpected characters at end of expression at position " + std::to_string(ctx.position));
+        co_return std::vector<double>{};
       }
+      co_return co_await evaluatePlanColumns(plan, values);
+    }
 
-      spdlog::info("[CalculatorService] Result: {}", result);
-      co_return result;
+    /// @brief Get the result cache, for its statistics. Only use it from the service's own thread.
+    [[nodiscard]] const CalculatorResultCache& GetResultCache() const noexcept
+    {
+      return m_resultCache;
     }
   };
 
@@ -15,8 +15,11 @@
 
 #include <Test2/Framework/Service/IServiceFactory.hpp>
 #include <Test2/Framework/Service/ServiceCreateInfo.hpp>
+#include <Test2/Services/Calculator/CalculatorEvaluationMode.hpp>
 #include <Test2/Services/Calculator/CalculatorService.hpp>
 #include <Test2/Services/Calculator/ICalculatorService.hpp>
+#include <Test2/Services/ServiceConfig.hpp>
+#include <cstddef>
 #include <memory>
 #include <span>
 #include <stdexcept>
@@ -27,8 +30,18 @@ namespace Test2
   /// @brief Factory for creating CalculatorService instances.
   class CalculatorServiceFactory final : public IServiceFactory
   {
+    CalculatorEvaluationMode m_evaluationMode;
+    std::size_t m_resultCacheCapacity;
+
   public:
-    CalculatorServiceFactory() = default;
+    /// @param evaluationMode How the created services issue their arithmetic service calls, see CalculatorEvaluationMode.
+    /// @param resultCacheCapacity The number of expression results each created service keeps, zero disables the result cache.
+    explicit CalculatorServiceFactory(const CalculatorEvaluationMode evaluationMode = CalculatorEvaluationMode::Sequential,
+                                      const std::size_t resultCacheCapacity = Config::CALCULATOR_RESULT_CACHE_CAPACITY)
+      : m_evaluationMode(evaluationMode)
+      , m_resultCacheCapacity(resultCacheCapacity)
+    {
+    }
     ~CalculatorServiceFactory() override = default;
 
     std::span<const std::type_index> GetSupportedInterfaces() const override
@@ -37,11 +50,17 @@ namespace Test2
       return std::span<const std::type_index>(interfaces);
     }
 
+    std::span<const ServiceIdBinding> GetSupportedServiceIds() const override
+    {
+      static const ServiceIdBinding bindings[] = {MakeServiceIdBinding<ICalculatorService>()};
+      return std::span<const ServiceIdBinding>(bindings);
+    }
+
     std::shared_ptr<IServiceControl> Create(const std::type_index& type, const ServiceCreateInfo& createInfo) override
     {
       if (type == std::type_index(typeid(ICalculatorService)))
       {
-        return std::make_shared<CalculatorService>(createInfo);
+        return std::make_shared<CalculatorService>(createInfo, m_evaluationMode, m_resultCacheCapacity);
       }
       throw std::invalid_argument("CalculatorServiceFactory: unsupported interface type");
     }
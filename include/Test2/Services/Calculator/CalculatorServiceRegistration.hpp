@@ -16,10 +16,13 @@
 #include <Test2/Framework/Registry/IServiceRegistry.hpp>
 #include <Test2/Framework/Registry/ServiceLaunchPriority.hpp>
 #include <Test2/Services/Add/AddServiceFactory.hpp>
+#include <Test2/Services/Calculator/CalculatorEvaluationMode.hpp>
 #include <Test2/Services/Calculator/CalculatorServiceFactory.hpp>
 #include <Test2/Services/Divide/DivideServiceFactory.hpp>
 #include <Test2/Services/Multiply/MultiplyServiceFactory.hpp>
+#include <Test2/Services/ServiceConfig.hpp>
 #include <Test2/Services/Subtract/SubtractServiceFactory.hpp>
+#include <cstddef>
 #include <memory>
 
 namespace Test2
@@ -33,6 +36,8 @@ namespace Test2
   /// Each service runs in its own thread group for isolated execution.
   ///
   /// @param registry The service registry to register services with.
+  /// @param evaluationMode How the CalculatorService issues its arithmetic service calls, see CalculatorEvaluationMode.
+  /// @param resultCacheCapacity The number of expression results the CalculatorService keeps, zero disables the result cache.
   ///
   /// Example usage:
   /// @code
@@ -41,7 +46,9 @@ namespace Test2
   /// auto registrations = registry.ExtractRegistrations();
   /// // Process registrations to initialize services...
   /// @endcode
-  inline void RegisterCalculatorServices(IServiceRegistry& registry)
+  inline void RegisterCalculatorServices(IServiceRegistry& registry,
+                                         const CalculatorEvaluationMode evaluationMode = CalculatorEvaluationMode::Sequential,
+                                         const std::size_t resultCacheCapacity = Config::CALCULATOR_RESULT_CACHE_CAPACITY)
   {
     // Create unique thread groups for each service
     const auto addThreadGroup = registry.CreateServiceThreadGroupId();
@@ -63,7 +70,7 @@ namespace Test2
     registry.RegisterService(std::make_unique<DivideServiceFactory>(), MathServicePriority, divideThreadGroup);
 
     // Register calculator service at lower priority so dependencies are resolved first
-    registry.RegisterService(std::make_unique<CalculatorServiceFactory>(), CalculatorServicePriority, calculatorThreadGroup);
+    registry.RegisterService(std::make_unique<CalculatorServiceFactory>(evaluationMode, resultCacheCapacity), CalculatorServicePriority, calculatorThreadGroup);
   }
 
 }
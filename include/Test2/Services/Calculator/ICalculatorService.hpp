@@ -14,8 +14,11 @@
 //****************************************************************************************************************************************************
 
 #include <Test2/Framework/Service/IService.hpp>
+#include <Test2/Services/ServiceIds.hpp>
 #include <boost/asio/awaitable.hpp>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace Test2
 {
@@ -26,6 +29,8 @@ namespace Test2
   class ICalculatorService : public IService
   {
   public:
+    static constexpr ServiceId Id = ServiceIds::Calculator;
+
     ~ICalculatorService() override = default;
 
     /// @brief Asynchronously evaluates a mathematical expression.
@@ -33,6 +38,22 @@ namespace Test2
     /// @return An awaitable yielding the result of the expression evaluation.
     /// @throws std::invalid_argument if the expression is malformed.
     virtual boost::asio::awaitable<double> EvaluateAsync(std::string expression) = 0;
+
+    /// @brief Asynchronously evaluates many expressions in one call.
+    /// @param expressions The expressions to evaluate, they must stay valid until the awaitable completes.
+    /// @return An awaitable yielding one result per expression, in the same order.
+    /// @throws std::invalid_argument if an expression is malformed, the first failing expression ends the call.
+    virtual boost::asio::awaitable<std::vector<double>> EvaluateManyAsync(std::span<const std::string> expressions) = 0;
+
+    /// @brief Asynchronously evaluates one expression for every value of a variable.
+    /// @param expression The expression, it refers to the variable by name (e.g., "x * 2 + 1"). Write a negated variable as (0 - x).
+    /// @param variable The variable name, a letter or underscore followed by letters, digits or underscores.
+    /// @param values The values of the variable, they must stay valid until the awaitable completes.
+    /// @return An awaitable yielding one result per value, in the same order.
+    /// @throws std::invalid_argument if the expression is malformed or uses any other variable.
+    /// @throws std::runtime_error if the expression divides by zero for any of the values.
+    virtual boost::asio::awaitable<std::vector<double>> EvaluateManyAsync(std::string expression, std::string variable,
+                                                                          std::span<const double> values) = 0;
   };
 
 }
@@ -18,12 +18,18 @@
 #include <Test2/Framework/Service/ServiceCreateInfo.hpp>
 #include <Test2/Framework/Service/ServiceInitResult.hpp>
 #include <Test2/Framework/Service/ServiceShutdownResult.hpp>
+#include <Test2/Services/BatchArithmetic.hpp>
 #include <Test2/Services/Divide/IDivideService.hpp>
 #include <Test2/Services/ServiceConfig.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <chrono>
+#include <span>
 #include <stdexcept>
-#include <thread>
+#include <vector>
 
 namespace Test2
 {
@@ -55,7 +61,13 @@ namespace Test2
 
     ProcessResult Process() override
     {
-      return ProcessResult{ProcessStatus::Idle};
+      return ProcessResult::NoSleepLimit();
+    }
+
+    ServiceTickPolicy GetTickPolicy() const override
+    {
+      // All work arrives as posted requests, there is nothing to do per tick
+      return ServiceTickPolicy::Never();
     }
 
     boost::asio::awaitable<double> DivideAsync(const double a, const double b) override
@@ -66,9 +78,26 @@ namespace Test2
         throw std::runtime_error("Division by zero");
       }
       spdlog::info("[DivideService] {} / {}", a, b);
-      std::this_thread::sleep_for(std::chrono::milliseconds(Config::DIVIDE_SERVICE_DELAY_MS));
+      const auto executor = co_await boost::asio::this_coro::executor;
+      boost::asio::steady_timer timer(executor, std::chrono::milliseconds(Config::DIVIDE_SERVICE_DELAY_MS));
+      co_await timer.async_wait(boost::asio::use_awaitable);
       co_return a / b;
     }
+
+    boost::asio::awaitable<std::vector<double>> DivideManyAsync(const std::span<const double> a, const std::span<const double> b) override
+    {
+      BatchArithmetic::ValidateOperands(a, b);
+      if (std::find(b.begin(), b.end(), 0.0) != b.end())
+      {
+        spdlog::error("[DivideService] Division by zero in batch of {}", a.size());
+        throw std::runtime_error("Division by zero");
+      }
+      spdlog::info("[DivideService] batch of {}", a.size());
+      const auto executor = co_await boost::asio::this_coro::executor;
+      boost::asio::steady_timer timer(executor, std::chrono::milliseconds(Config::DIVIDE_SERVICE_DELAY_MS));
+      co_await timer.async_wait(boost::asio::use_awaitable);
+      co_return BatchArithmetic::Apply(a, b, [](const double lhs, const double rhs) { return lhs / rhs; });
+    }
   };
 
 }
@@ -14,7 +14,10 @@
 //****************************************************************************************************************************************************
 
 #include <Test2/Framework/Service/IService.hpp>
+#include <Test2/Services/ServiceIds.hpp>
 #include <boost/asio/awaitable.hpp>
+#include <span>
+#include <vector>
 
 namespace Test2
 {
@@ -22,6 +25,8 @@ namespace Test2
   class IDivideService : public IService
   {
   public:
+    static constexpr ServiceId Id = ServiceIds::Divide;
+
     ~IDivideService() override = default;
 
     /// @brief Asynchronously divides two numbers.
@@ -30,6 +35,15 @@ namespace Test2
     /// @return An awaitable yielding the quotient (a / b).
     /// @throws std::runtime_error if b is zero.
     virtual boost::asio::awaitable<double> DivideAsync(double a, double b) = 0;
+
+    /// @brief Asynchronously divides many pairs of numbers in one call, the result element i is a[i] / b[i].
+    /// @param a The left operands.
+    /// @param b The right operands, must have the same size as a.
+    /// @return An awaitable yielding the quotients.
+    /// @throws std::invalid_argument if a and b differ in size.
+    /// @throws std::runtime_error if any element of b is zero.
+    /// @note The spans are read while the call runs, so the data must stay valid until the awaitable completes.
+    virtual boost::asio::awaitable<std::vector<double>> DivideManyAsync(std::span<const double> a, std::span<const double> b) = 0;
   };
 
 }
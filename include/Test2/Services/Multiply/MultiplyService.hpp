@@ -18,11 +18,16 @@
 #include <Test2/Framework/Service/ServiceCreateInfo.hpp>
 #include <Test2/Framework/Service/ServiceInitResult.hpp>
 #include <Test2/Framework/Service/ServiceShutdownResult.hpp>
+#include <Test2/Services/BatchArithmetic.hpp>
 #include <Test2/Services/Multiply/IMultiplyService.hpp>
 #include <Test2/Services/ServiceConfig.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <spdlog/spdlog.h>
 #include <chrono>
-#include <thread>
+#include <span>
+#include <vector>
 
 namespace Test2
 {
@@ -54,15 +59,33 @@ namespace Test2
 
     ProcessResult Process() override
     {
-      return ProcessResult{ProcessStatus::Idle};
+      return ProcessResult::NoSleepLimit();
+    }
+
+    ServiceTickPolicy GetTickPolicy() const override
+    {
+      // All work arrives as posted requests, there is nothing to do per tick
+      return ServiceTickPolicy::Never();
     }
 
     boost::asio::awaitable<double> MultiplyAsync(const double a, const double b) override
     {
       spdlog::info("[MultiplyService] {} * {}", a, b);
-      std::this_thread::sleep_for(std::chrono::milliseconds(Config::MULTIPLY_SERVICE_DELAY_MS));
+      const auto executor = co_await boost::asio::this_coro::executor;
+      boost::asio::steady_timer timer(executor, std::chrono::milliseconds(Config::MULTIPLY_SERVICE_DELAY_MS));
+      co_await timer.async_wait(boost::asio::use_awaitable);
       co_return a* b;
     }
+
+    boost::asio::awaitable<std::vector<double>> MultiplyManyAsync(const std::span<const double> a, const std::span<const double> b) override
+    {
+      BatchArithmetic::ValidateOperands(a, b);
+      spdlog::info("[MultiplyService] batch of {}", a.size());
+      const auto executor = co_await boost::asio::this_coro::executor;
+      boost::asio::steady_timer timer(executor, std::chrono::milliseconds(Config::MULTIPLY_SERVICE_DELAY_MS));
+      co_await timer.async_wait(boost::asio::use_awaitable);
+      co_return BatchArithmetic::Apply(a, b, [](const double lhs, const double rhs) { return lhs * rhs; });
+    }
   };
 
 }
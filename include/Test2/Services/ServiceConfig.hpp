@@ -13,6 +13,8 @@
 //* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 //****************************************************************************************************************************************************
 
+#include <cstddef>
+
 namespace Test2
 {
   namespace Config
@@ -22,6 +24,12 @@ namespace Test2
     constexpr int SUBTRACT_SERVICE_DELAY_MS = 20;
     constexpr int MULTIPLY_SERVICE_DELAY_MS = 15;
     constexpr int DIVIDE_SERVICE_DELAY_MS = 23;
+
+    // The number of compiled expressions the calculator service keeps
+    constexpr std::size_t CALCULATOR_PLAN_CACHE_CAPACITY = 512;
+
+    // The number of expression results the calculator service keeps unless configured otherwise, zero disables result caching
+    constexpr std::size_t CALCULATOR_RESULT_CACHE_CAPACITY = 0;
   }
 }
 
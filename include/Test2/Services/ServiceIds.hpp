@@ -0,0 +1,32 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_SERVICES_SERVICEIDS_HPP
+#define SERVICE_FRAMEWORK_TEST2_SERVICES_SERVICEIDS_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+
+#include <Test2/Framework/Service/ServiceId.hpp>
+
+namespace Test2
+{
+  namespace ServiceIds
+  {
+    // Compile-time ids of the example service interfaces, kept dense as they index the provider's slot table
+    constexpr ServiceId Add{0};
+    constexpr ServiceId Subtract{1};
+    constexpr ServiceId Multiply{2};
+    constexpr ServiceId Divide{3};
+    constexpr ServiceId Calculator{4};
+  }
+}
+
+#endif
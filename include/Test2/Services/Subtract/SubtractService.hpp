@@ -19,10 +19,15 @@
 #include <Test2/Framework/Service/ServiceInitResult.hpp>
 #include <Test2/Framework/Service/ServiceShutdownResult.hpp>
 #include <Test2/Services/ServiceConfig.hpp>
+#include <Test2/Services/BatchArithmetic.hpp>
 #include <Test2/Services/Subtract/ISubtractService.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <spdlog/spdlog.h>
 #include <chrono>
-#include <thread>
+#include <span>
+#include <vector>
 
 namespace Test2
 {
@@ -54,15 +59,33 @@ namespace Test2
 
     ProcessResult Process() override
     {
-      return ProcessResult{ProcessStatus::Idle};
+      return ProcessResult::NoSleepLimit();
+    }
+
+    ServiceTickPolicy GetTickPolicy() const override
+    {
+      // All work arrives as posted requests, there is nothing to do per tick
+      return ServiceTickPolicy::Never();
     }
 
     boost::asio::awaitable<double> SubtractAsync(const double a, const double b) override
     {
       spdlog::info("[SubtractService] {} - {}", a, b);
-      std::this_thread::sleep_for(std::chrono::milliseconds(Config::SUBTRACT_SERVICE_DELAY_MS));
+      const auto executor = co_await boost::asio::this_coro::executor;
+      boost::asio::steady_timer timer(executor, std::chrono::milliseconds(Config::SUBTRACT_SERVICE_DELAY_MS));
+      co_await timer.async_wait(boost::asio::use_awaitable);
       co_return a - b;
     }
+
+    boost::asio::awaitable<std::vector<double>> SubtractManyAsync(const std::span<const double> a, const std::span<const double> b) override
+    {
+      BatchArithmetic::ValidateOperands(a, b);
+      spdlog::info("[SubtractService] batch of {}", a.size());
+      const auto executor = co_await boost::asio::this_coro::executor;
+      boost::asio::steady_timer timer(executor, std::chrono::milliseconds(Config::SUBTRACT_SERVICE_DELAY_MS));
+      co_await timer.async_wait(boost::asio::use_awaitable);
+      co_return BatchArithmetic::Apply(a, b, [](const double lhs, const double rhs) { return lhs - rhs; });
+    }
   };
 
 }
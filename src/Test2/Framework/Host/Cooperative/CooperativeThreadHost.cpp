@@ -73,4 +73,31 @@ namespace Test2
     }
     return m_serviceHost->Poll();
   }
+
+  std::size_t CooperativeThreadHost::WaitForWork(const ProcessResult& processResult)
+  {
+    if (!m_serviceHost)
+    {
+      throw std::runtime_error("Service host is no longer available");
+    }
+    return m_serviceHost->WaitForWork(processResult);
+  }
+
+  void CooperativeThreadHost::SetProcessTimingEnabled(const bool enabled)
+  {
+    if (!m_serviceHost)
+    {
+      throw std::runtime_error("Service host is no longer available");
+    }
+    m_serviceHost->SetProcessTimingEnabled(enabled);
+  }
+
+  std::vector<ServiceProcessTiming> CooperativeThreadHost::GetProcessTimings() const
+  {
+    if (!m_serviceHost)
+    {
+      throw std::runtime_error("Service host is no longer available");
+    }
+    return m_serviceHost->GetProcessTimings();
+  }
 };
@@ -19,15 +19,18 @@
 #include <Test2/Framework/Service/ProcessResult.hpp>
 #include <boost/asio/awaitable.hpp>
 #include <boost/asio/co_spawn.hpp>
+#include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/post.hpp>
 #include <boost/asio/use_awaitable.hpp>
 #include <fmt/std.h>
 #include <spdlog/spdlog.h>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -47,7 +50,7 @@ namespace Test2
   /// Key characteristics:
   /// - No work guard - io_context lifetime is managed externally
   /// - poll()-based execution - processes ready handlers without blocking
-  /// - Wake callback - notifies the host thread when async work is posted
+  /// - Wake callback - notifies the host thread when async work is posted, bursts of posts are coalesced into one wake
   /// - Update() convenience method - combines Poll() and ProcessServices()
   ///
   /// Usage pattern:
@@ -55,10 +58,20 @@ namespace Test2
   /// 2. Register a wake callback that signals the main loop to call Update()
   /// 3. Call Update() from the main loop when signaled or on each iteration
   /// 4. Update() returns ProcessResult with sleep hints for the main loop
+  /// 5. Optionally pass that ProcessResult to WaitForWork() to block until there is something to do
   class CooperativeThreadServiceHost : public ServiceHostBase
   {
-    WakeCallback m_wakeCallback;
-    mutable std::mutex m_wakeMutex;
+    /// @brief Owns the current wake callback, only touched by the owner thread.
+    std::unique_ptr<const WakeCallback> m_wakeCallbackStorage;
+    /// @brief The callback PostWithWake invokes, a plain pointer so reading it never takes a lock.
+    std::atomic<const WakeCallback*> m_wakeCallback{nullptr};
+    /// @brief The number of threads currently invoking the wake callback, SetWakeCallback waits for it to drop to zero before it
+    ///        destroys the callback it replaced.
+    std::atomic<std::uint32_t> m_activeWakeCount{0};
+    /// @brief Set by the first PostWithWake that invoked the callback after the host last polled, every later post until the next
+    ///        poll skips the callback.
+    std::atomic<bool> m_wakePending{false};
+    std::atomic<bool> m_stopRequested{false};
 
 
   public:
@@ -74,29 +87,39 @@ namespace Test2
 
     ~CooperativeThreadServiceHost() override
     {
+      if (m_wakeCallback.load(std::memory_order_acquire))
       {
-        std::lock_guard<std::mutex> lock(m_wakeMutex);
-        if (m_wakeCallback)
-        {
-          spdlog::warn("CooperativeThreadServiceHost destroyed with wake callback still set");
-        }
+        spdlog::warn("CooperativeThreadServiceHost destroyed with wake callback still set");
       }
       spdlog::info("CooperativeThreadServiceHost destroying at {}", static_cast<void*>(this));
     }
 
     /// @brief Set the wake callback to notify the host thread when async work is posted.
     ///
-    /// The wake callback is invoked whenever asynchronous work is posted to the io_context,
+    /// The wake callback is invoked when asynchronous work is posted to the io_context,
     /// allowing the host thread's event loop to wake up and call Poll() or Update().
+    /// Wakes are coalesced: after the first post only the next Poll(), Update() or WaitForWork() re-arms the callback,
+    /// so a burst of posts results in a single call. Setting a callback re-arms it too, work posted while no callback was set
+    /// is picked up by the next poll.
+    ///
+    /// If another thread is still running the previous callback, this waits for it to return before destroying it.
     ///
-    /// @param callback The callback to invoke. MUST be thread-safe as it may be called from any thread.
-    ///                 Pass nullptr to clear the callback.
+    /// @param callback The callback to invoke. MUST be thread-safe as it may be called from any thread, and must not call
+    ///                 SetWakeCallback itself. Pass nullptr to clear the callback.
     /// @throws WrongThreadException if called from a thread other than the owner thread.
     void SetWakeCallback(WakeCallback callback)
     {
       ValidateThreadAccess();
-      std::lock_guard<std::mutex> lock(m_wakeMutex);
-      m_wakeCallback = std::move(callback);
+      auto newCallback = callback ? std::make_unique<const WakeCallback>(std::move(callback)) : nullptr;
+
+      // Pairs with TriggerWake: a thread that registered itself before this store is waited for, a later one sees the new callback
+      m_wakeCallback.store(newCallback.get(), std::memory_order_seq_cst);
+      while (m_activeWakeCount.load(std::memory_order_seq_cst) != 0)
+      {
+        std::this_thread::yield();
+      }
+      m_wakeCallbackStorage = std::move(newCallback);
+      RearmWake();
     }
 
     /// @brief Process all ready handlers without blocking.
@@ -108,6 +131,8 @@ namespace Test2
     /// @throws WrongThreadException if called from a thread other than the owner thread.
     std::size_t Poll()
     {
+      RestartIfOutOfWork();
+      RearmWake();
       return DoPoll();
     }
 
@@ -122,6 +147,8 @@ namespace Test2
     /// @throws WrongThreadException if called from a thread other than the owner thread.
     ProcessResult Update()
     {
+      RestartIfOutOfWork();
+      RearmWake();
       return DoUpdate();
     }
 
@@ -130,6 +157,42 @@ namespace Test2
       return DoProcessServices();
     }
 
+    /// @brief Block the calling thread until work is posted to the io_context or the sleep limit expires.
+    ///
+    /// Intended to be called with the result of the previous Update() so an idle main loop sleeps instead of spinning:
+    /// - NoSleepLimit: waits until work is posted (or RequestStop() is called).
+    /// - SleepLimit: waits at most the given duration.
+    /// - Quit: returns immediately.
+    ///
+    /// The wait is done by the io_context itself, so any post into it from any thread wakes the caller immediately, there is
+    /// no need to use PostWithWake(). The first ready handler is executed as part of the wake up.
+    ///
+    /// @param processResult The sleep hint, normally the value returned by the last Update().
+    /// @return The number of handlers that were executed (0 or 1).
+    /// @throws WrongThreadException if called from a thread other than the owner thread.
+    std::size_t WaitForWork(const ProcessResult& processResult)
+    {
+      RestartIfOutOfWork();
+      RearmWake();
+      if (processResult.Status == ProcessStatus::Quit || m_ioContext.stopped())
+      {
+        return 0;
+      }
+
+      // Keep run_one from returning just because there is no outstanding work, only a handler, the timeout or stop() ends the wait
+      auto work = boost::asio::make_work_guard(m_ioContext);
+      std::size_t handlerCount = 0;
+      if (processResult.Status == ProcessStatus::SleepLimit)
+      {
+        handlerCount = m_ioContext.run_one_for(processResult.Duration);
+      }
+      else
+      {
+        handlerCount = m_ioContext.run_one();
+      }
+      return handlerCount;
+    }
+
     /// @brief Post work to the io_context and trigger the wake callback.
     ///
     /// Use this method instead of directly posting to the io_context when you want
@@ -148,26 +211,70 @@ namespace Test2
     using ServiceHostBase::GetExecutor;
     /// @brief Request the io_context to stop.
     ///
-    /// This can be called from any thread to stop the io_context.
+    /// This can be called from any thread to stop the io_context, it also releases a thread blocked in WaitForWork().
     void RequestStop()
     {
+      m_stopRequested = true;
       m_ioContext.stop();
     }
 
   private:
-    /// @brief Invoke the wake callback if set.
+    /// @brief Restart the io_context if a previous poll() left it stopped because it ran out of work.
+    ///
+    /// poll() marks the io_context as stopped whenever it runs out of work, which would make every
+    /// following Poll() a no-op. An explicit RequestStop() is honored and never restarted.
+    void RestartIfOutOfWork()
+    {
+      ValidateThreadAccess();
+      if (m_ioContext.stopped() && !m_stopRequested.load())
+      {
+        m_ioContext.restart();
+        // RequestStop() may have raced the restart, so make sure the stop sticks
+        if (m_stopRequested.load())
+        {
+          m_ioContext.stop();
+        }
+      }
+    }
+
+    /// @brief Allow the next PostWithWake to invoke the wake callback again.
+    ///
+    /// Called before the io_context is polled, so anything posted after this point either gets picked up by the poll that
+    /// follows or triggers a new wake.
+    void RearmWake() noexcept
+    {
+      m_wakePending.store(false, std::memory_order_release);
+    }
+
+    /// @brief Invoke the wake callback if set and no wake is pending already.
     void TriggerWake()
     {
-      WakeCallback callback;
+      static_assert(std::atomic<const WakeCallback*>::is_always_lock_free);
+      // Without a callback there is nobody to wake, leave the latch alone so the first post after SetWakeCallback still wakes
+      if (m_wakeCallback.load(std::memory_order_relaxed) == nullptr)
+      {
+        return;
+      }
+      if (m_wakePending.exchange(true, std::memory_order_acq_rel))
       {
-        std::lock_guard<std::mutex> lock(m_wakeMutex);
-        callback = m_wakeCallback;
+        // The host thread has not polled since the last wake, it will see this post too
+        return;
       }
 
-      if (callback)
+      m_activeWakeCount.fetch_add(1, std::memory_order_seq_cst);
+      try
+      {
+        if (const WakeCallback* const pCallback = m_wakeCallback.load(std::memory_order_seq_cst))
+        {
+          (*pCallback)();
+        }
+      }
+      catch (...)
       {
-        callback();
+        m_activeWakeCount.fetch_sub(1, std::memory_order_release);
+        throw;
       }
+      m_activeWakeCount.fetch_sub(1, std::memory_order_release);
     }
   };
 }
@@ -13,18 +13,19 @@
 
 #include <Test2/Framework/Host/Managed/ManagedThreadHost.hpp>
 #include <Test2/Framework/Host/ServiceHostProxy.hpp>
-#include <boost/asio/post.hpp>
-#include <boost/asio/use_awaitable.hpp>
 #include <spdlog/spdlog.h>
-#include <future>
+#include <exception>
 #include <stdexcept>
 #include "../ServiceHostBase.hpp"
 #include "ManagedThreadServiceHost.hpp"
 
 namespace Test2
 {
-  ManagedThreadHost::ManagedThreadHost(ExecutorContext<ILifeTracker> sourceContext)
+  ManagedThreadHost::ManagedThreadHost(ExecutorContext<ILifeTracker> sourceContext, const ManagedThreadRunMode runMode)
     : m_sourceContext(std::move(sourceContext))
+    , m_runMode(runMode)
+    , m_startedSignal(m_sourceContext.GetExecutor())
+    , m_exitedSignal(m_sourceContext.GetExecutor())
   {
   }
 
@@ -45,6 +46,31 @@ namespace Test2
   }
 
   boost::asio::awaitable<ManagedThreadRecord> ManagedThreadHost::StartAsync()
+  {
+    LaunchThread();
+    co_return co_await CompleteStartAsync();
+  }
+
+
+  boost::asio::awaitable<std::vector<ManagedThreadRecord>> ManagedThreadHost::StartAllAsync(std::span<ManagedThreadHost* const> hosts)
+  {
+    // Launch every thread first so their start up overlaps
+    for (auto* host : hosts)
+    {
+      host->LaunchThread();
+    }
+
+    std::vector<ManagedThreadRecord> records;
+    records.reserve(hosts.size());
+    for (auto* host : hosts)
+    {
+      records.push_back(co_await host->CompleteStartAsync());
+    }
+    co_return records;
+  }
+
+
+  void ManagedThreadHost::LaunchThread()
   {
     // Guard against multiple starts
     if (m_thread.joinable())
@@ -52,52 +78,56 @@ namespace Test2
       throw std::runtime_error("ManagedThreadHost has already been started");
     }
 
-    auto lifetimePromise = std::make_shared<std::promise<void>>();
-    auto lifetimeFuture = lifetimePromise->get_future();
-    auto startedPromise = std::make_shared<std::promise<void>>();
-    auto startedFuture = startedPromise->get_future();
+    m_startedSignal = Util::AsyncSignal(m_sourceContext.GetExecutor());
+    m_exitedSignal = Util::AsyncSignal(m_sourceContext.GetExecutor());
 
     m_thread = std::thread(
-      [this, lifetimePromise, startedPromise]()
+      [this, startedSignal = m_startedSignal, exitedSignal = m_exitedSignal]() mutable
       {
+        bool started = false;
         try
         {
           // Construct the service host ON THIS THREAD with parent cancellation slot
-          auto serviceHost = std::make_shared<ManagedThreadServiceHost>();
+          auto serviceHost = std::make_shared<ManagedThreadServiceHost>(m_runMode);
           m_serviceHostProxy = std::make_shared<ServiceHostProxy>(
             DispatchContext(m_sourceContext, ExecutorContext(std::static_pointer_cast<ServiceHostBase>(serviceHost), serviceHost->GetExecutor())));
 
-          // Signal that thread has started
-          startedPromise->set_value();
+          // Signal that thread has started, this resumes the starter on its own executor
+          started = true;
+          startedSignal.Set();
 
           // Run the io_context - it will be stopped via the cancellation slot
           serviceHost->Run();
 
           // Signal lifetime completion
-          lifetimePromise->set_value();
+          exitedSignal.Set();
         }
         catch (...)
         {
-          lifetimePromise->set_exception(std::current_exception());
+          if (!started)
+          {
+            // Don't leave the starter waiting forever if the service host could not be constructed
+            startedSignal.SetException(std::current_exception());
+          }
+          exitedSignal.SetException(std::current_exception());
         }
       });
+  }
 
-    // Wait for thread to start and serviceHost to be assigned
-    startedFuture.wait();
+
+  boost::asio::awaitable<ManagedThreadRecord> ManagedThreadHost::CompleteStartAsync()
+  {
+    // Wait for thread to start and serviceHost to be assigned, the calling executor keeps running other work meanwhile
+    co_await m_startedSignal.WaitAsync();
 
     if (!m_serviceHostProxy)
     {
       throw std::runtime_error("ManagedThreadHost failed to start service host");
     }
 
-    // Create the lifetime awaitable from the future
-    auto executor = co_await boost::asio::this_coro::executor;
-    co_return ManagedThreadRecord{[](std::shared_future<void> future, auto exec) -> boost::asio::awaitable<void>
-                                  {
-                                    co_await boost::asio::post(exec, boost::asio::use_awaitable);
-                                    future.wait();
-                                    co_return;
-                                  }(std::move(lifetimeFuture).share(), executor)};
+    // Create the lifetime awaitable from the exit signal
+    co_return ManagedThreadRecord{[](Util::AsyncSignal exitedSignal) -> boost::asio::awaitable<void>
+                                  { co_await exitedSignal.WaitAsync(); }(m_exitedSignal)};
   }
 
 
@@ -111,14 +141,26 @@ namespace Test2
 
     bool result = co_await m_serviceHostProxy->TryRequestShutdownAsync();
 
-    // Wait for the thread to complete after requesting shutdown
+    // Wait for the thread to complete after requesting shutdown, once the exit signal is set the join only reaps the thread
+    std::exception_ptr exitException;
+    try
+    {
+      co_await m_exitedSignal.WaitAsync();
+    }
+    catch (...)
+    {
+      exitException = std::current_exception();
+    }
+
     if (m_thread.joinable())
     {
-      auto executor = co_await boost::asio::this_coro::executor;
-      co_await boost::asio::post(executor, boost::asio::use_awaitable);
       m_thread.join();
     }
 
+    if (exitException)
+    {
+      std::rethrow_exception(exitException);
+    }
     co_return result;
   }
 
@@ -131,4 +173,24 @@ namespace Test2
     }
     throw std::runtime_error("Service host is no longer available");
   }
+
+
+  boost::asio::awaitable<void> ManagedThreadHost::SetProcessTimingEnabledAsync(const bool enabled)
+  {
+    if (!m_serviceHostProxy)
+    {
+      throw std::runtime_error("Service host is no longer available");
+    }
+    co_await m_serviceHostProxy->SetProcessTimingEnabledAsync(enabled);
+  }
+
+
+  boost::asio::awaitable<std::vector<ServiceProcessTiming>> ManagedThreadHost::GetProcessTimingsAsync()
+  {
+    if (!m_serviceHostProxy)
+    {
+      throw std::runtime_error("Service host is no longer available");
+    }
+    co_return co_await m_serviceHostProxy->GetProcessTimingsAsync();
+  }
 }
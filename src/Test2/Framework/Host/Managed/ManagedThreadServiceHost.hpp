@@ -13,13 +13,16 @@
 //* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 //****************************************************************************************************************************************************
 
+#include <Test2/Framework/Host/Managed/ManagedThreadRunMode.hpp>
 #include <Test2/Framework/Host/ServiceHostBase.hpp>
 #include <Test2/Framework/Host/StartServiceRecord.hpp>
 #include <Test2/Framework/Registry/ServiceLaunchPriority.hpp>
+#include <Test2/Framework/Service/ProcessResult.hpp>
 #include <boost/asio/awaitable.hpp>
 #include <boost/asio/cancellation_signal.hpp>
 #include <boost/asio/co_spawn.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/asio/use_awaitable.hpp>
 #include <spdlog/spdlog.h>
 #include <memory>
@@ -31,16 +34,23 @@ namespace Test2
   ///
   /// This host owns an io_context with a work guard, keeping the event loop running until
   /// explicitly stopped. Use RunAsync() to start the event loop on the managed thread.
+  /// In ManagedThreadRunMode::ProcessTick the loop also calls Process() on the hosted services, see RunProcessTick().
   class ManagedThreadServiceHost : public ServiceHostBase
   {
     boost::asio::executor_work_guard<boost::asio::io_context::executor_type> m_work;
+    ManagedThreadRunMode m_runMode;
+    /// @brief Wakes the tick loop when the merged SleepLimit expires.
+    boost::asio::steady_timer m_tickTimer;
+    bool m_tickStopRequested{false};
 
   public:
     /// @brief Constructs a ManagedThreadServiceHost.
-    /// @param cancel_slot Optional cancellation slot to stop the io_context.
-    explicit ManagedThreadServiceHost()
+    /// @param runMode How Run() drives the io_context.
+    explicit ManagedThreadServiceHost(const ManagedThreadRunMode runMode = ManagedThreadRunMode::EventLoop)
       : ServiceHostBase()
       , m_work(boost::asio::make_work_guard(m_ioContext))
+      , m_runMode(runMode)
+      , m_tickTimer(m_ioContext)
     {
       spdlog::info("ManagedThreadServiceHost created at {}", static_cast<void*>(this));
     }
@@ -55,12 +65,69 @@ namespace Test2
     void RequestShutdown() final
     {
       ServiceHostBase::RequestShutdown();
+      m_tickStopRequested = true;
+      m_tickTimer.cancel();
       m_work.reset();
     }
 
     void Run()
     {
-      DoRun();
+      if (m_runMode == ManagedThreadRunMode::ProcessTick)
+      {
+        RunProcessTick();
+      }
+      else
+      {
+        DoRun();
+      }
+    }
+
+  private:
+    /// @brief Runs the io_context handlers interleaved with service Process() calls until shutdown is requested.
+    ///
+    /// Each tick runs all ready handlers, processes the services and then blocks in run_one() until either new work is posted
+    /// or the sleep limit timer fires, so an idle thread does not spin.
+    void RunProcessTick()
+    {
+      ValidateThreadAccess();
+      spdlog::trace("ManagedThreadServiceHost starting process tick loop at {}", static_cast<void*>(this));
+
+      bool processServices = true;
+      while (!m_tickStopRequested)
+      {
+        m_ioContext.poll();
+        if (m_tickStopRequested || m_ioContext.stopped())
+        {
+          break;
+        }
+
+        if (processServices)
+        {
+          const ProcessResult result = DoProcessServices();
+          switch (result.Status)
+          {
+          case ProcessStatus::Quit:
+            spdlog::info("ManagedThreadServiceHost services requested quit, no longer calling Process() at {}", static_cast<void*>(this));
+            processServices = false;
+            break;
+          case ProcessStatus::SleepLimit:
+            m_tickTimer.expires_after(result.Duration);
+            m_tickTimer.async_wait([](const boost::system::error_code&) {});
+            break;
+          case ProcessStatus::NoSleepLimit:
+          default:
+            break;
+          }
+        }
+
+        // Sleep until work is posted or the sleep limit expires
+        m_ioContext.run_one();
+        m_tickTimer.cancel();
+      }
+
+      // Drain the remaining handlers, run() returns once the released work guard lets the io_context run out of work
+      m_ioContext.run();
+      spdlog::trace("ManagedThreadServiceHost process tick loop has exited at {}", static_cast<void*>(this));
     }
   };
 }
@@ -24,10 +24,15 @@
 #include <Test2/Framework/Service/IService.hpp>
 #include <fmt/std.h>
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <span>
 #include <thread>
 #include <typeindex>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Test2
@@ -43,13 +48,209 @@ namespace Test2
     {
       ServiceLaunchPriority Priority;
       std::vector<ServiceInstanceInfo> Services;
+      /// @brief Removal handles, the type bucket of every supported interface of every service in registration order.
+      std::vector<std::uint32_t> TypeBuckets{};
     };
 
   private:
+    static constexpr std::uint32_t NoIdSlot = std::numeric_limits<std::uint32_t>::max();
+
+    /// @brief All services registered for one interface, in registration order.
+    ///
+    /// Buckets are never removed, so their index is a stable removal handle. A bucket whose services were all unregistered stays
+    /// behind empty and is reused when the interface is registered again.
+    struct TypeBucket
+    {
+      std::type_index Type;
+      std::vector<std::shared_ptr<IServiceControl>> Services{};
+      /// @brief The ServiceId slot bound to the interface or NoIdSlot.
+      std::uint32_t IdSlot{NoIdSlot};
+    };
+
+    /// @brief The interface a ServiceId is bound to and, if exactly one service supports it, that service already cast to the interface.
+    struct ServiceIdSlot
+    {
+      const std::type_info* pType{nullptr};
+      std::shared_ptr<IService> (*Bind)(const std::shared_ptr<IServiceControl>& service){nullptr};
+      std::uint32_t BucketIndex{0};
+      /// @brief The number of registered services that declare the binding, the slot is released when it drops to zero.
+      std::uint32_t BindingCount{0};
+      std::shared_ptr<IService> Service;
+    };
+
     std::vector<PriorityGroup> m_priorityGroups;
-    std::unordered_multimap<std::type_index, std::shared_ptr<IServiceControl>> m_servicesByType;
+    std::vector<TypeBucket> m_typeBuckets;
+    /// @brief The type hash of every bucket sorted ascending, kept in its own array so the binary search only touches packed integers.
+    std::vector<std::size_t> m_typeHashes;
+    /// @brief The bucket index of each m_typeHashes entry.
+    std::vector<std::uint32_t> m_typeHashBuckets;
+    /// @brief Dense ServiceId slots.
+    std::vector<ServiceIdSlot> m_servicesById;
+    /// @brief Every registered service in registration order, so the process tick neither allocates nor touches reference counts.
+    ///        The services are owned by m_priorityGroups.
+    std::vector<IServiceControl*> m_processList;
+    /// @brief Bumped on every registration change, so ServiceHandle knows when to resolve again.
+    std::shared_ptr<ServiceProviderGeneration> m_generation;
     std::thread::id m_ownerThreadId;
 
+    /// @brief Finds the position of the first m_typeHashes entry that is not less than the hash.
+    std::size_t LowerBoundTypeHash(const std::size_t typeHash) const noexcept
+    {
+      const std::size_t count = m_typeHashes.size();
+
+      // Branchless lower bound, the probe order depends on the hash so a branchy search would mispredict on most steps
+      const std::size_t* pBase = m_typeHashes.data();
+      std::size_t length = count;
+      while (length > 1)
+      {
+        const std::size_t half = length / 2;
+        pBase = pBase[half] < typeHash ? pBase + half : pBase;
+        length -= half;
+      }
+      return static_cast<std::size_t>(pBase - m_typeHashes.data()) + (count > 0 && *pBase < typeHash ? 1 : 0);
+    }
+
+    /// @brief Finds the bucket of the type.
+    /// @return The bucket index or m_typeBuckets.size() if the type was never registered.
+    std::size_t FindTypeBucket(const std::type_index typeIndex) const noexcept
+    {
+      const std::size_t typeHash = typeIndex.hash_code();
+      // Skip other types that share the hash
+      for (std::size_t i = LowerBoundTypeHash(typeHash); i < m_typeHashes.size() && m_typeHashes[i] == typeHash; ++i)
+      {
+        if (m_typeBuckets[m_typeHashBuckets[i]].Type == typeIndex)
+        {
+          return m_typeHashBuckets[i];
+        }
+      }
+      return m_typeBuckets.size();
+    }
+
+    /// @brief Finds the bucket of the type, adding an empty bucket if the type was never registered.
+    std::uint32_t FindOrAddTypeBucket(const std::type_index typeIndex)
+    {
+      std::size_t bucketIndex = FindTypeBucket(typeIndex);
+      if (bucketIndex == m_typeBuckets.size())
+      {
+        const std::size_t position = LowerBoundTypeHash(typeIndex.hash_code());
+        m_typeBuckets.push_back(TypeBucket{typeIndex});
+        m_typeHashes.insert(m_typeHashes.begin() + static_cast<std::ptrdiff_t>(position), typeIndex.hash_code());
+        m_typeHashBuckets.insert(m_typeHashBuckets.begin() + static_cast<std::ptrdiff_t>(position), static_cast<std::uint32_t>(bucketIndex));
+      }
+      return static_cast<std::uint32_t>(bucketIndex);
+    }
+
+    /// @brief Finds the services registered for the type, in registration order.
+    std::span<const std::shared_ptr<IServiceControl>> FindServices(const std::type_info& type) const
+    {
+      const std::size_t bucketIndex = FindTypeBucket(std::type_index(type));
+      if (bucketIndex == m_typeBuckets.size())
+      {
+        return {};
+      }
+      return m_typeBuckets[bucketIndex].Services;
+    }
+
+    /// @brief Adds a binding of a service that is being registered to its ServiceId slot.
+    void AddServiceIdBinding(const ServiceIdBinding& binding)
+    {
+      if (binding.Id.Value >= m_servicesById.size())
+      {
+        m_servicesById.resize(static_cast<std::size_t>(binding.Id.Value) + 1);
+      }
+      auto& slot = m_servicesById[binding.Id.Value];
+      if (slot.BindingCount == 0)
+      {
+        const std::size_t bucketIndex = FindTypeBucket(std::type_index(*binding.pType));
+        slot.pType = binding.pType;
+        slot.Bind = binding.Bind;
+        slot.BucketIndex = static_cast<std::uint32_t>(bucketIndex);
+        m_typeBuckets[bucketIndex].IdSlot = binding.Id.Value;
+      }
+      ++slot.BindingCount;
+    }
+
+    /// @brief Removes a binding of a service that is being unregistered from its ServiceId slot.
+    void RemoveServiceIdBinding(const ServiceIdBinding& binding)
+    {
+      auto& slot = m_servicesById[binding.Id.Value];
+      if (--slot.BindingCount == 0)
+      {
+        m_typeBuckets[slot.BucketIndex].IdSlot = NoIdSlot;
+        slot = ServiceIdSlot{};
+      }
+    }
+
+    /// @brief Updates the ServiceId fast path of a bucket whose services changed.
+    void RefreshServiceIdSlot(const std::uint32_t bucketIndex)
+    {
+      const auto& bucket = m_typeBuckets[bucketIndex];
+      if (bucket.IdSlot == NoIdSlot)
+      {
+        return;
+      }
+      // Only a type with a single service gets the fast path, the type based lookup reports the ambiguity otherwise.
+      // A bound type always contains the services that declared the binding, so a single service is one of them.
+      auto& slot = m_servicesById[bucket.IdSlot];
+      slot.Service = bucket.Services.size() == 1 ? slot.Bind(bucket.Services.front()) : nullptr;
+    }
+
+    /// @brief Validates the ServiceId bindings of a service that is about to be registered.
+    /// @param index The index of the service in its priority group, used for error messages.
+    /// @param info The service to validate.
+    /// @param newBindings The bindings of the group validated so far, used to detect conflicting ids within the group.
+    void ValidateServiceIdBindings(const std::size_t index, const ServiceInstanceInfo& info, const std::vector<ServiceIdBinding>& newBindings) const
+    {
+      for (const auto& binding : info.SupportedServiceIds)
+      {
+        if (binding.pType == nullptr || binding.Bind == nullptr)
+        {
+          throw std::invalid_argument(fmt::format("Service at index {} has an incomplete ServiceId binding for id {}", index, binding.Id.Value));
+        }
+        if (binding.Id.Value > ServiceId::MaxValue)
+        {
+          throw std::invalid_argument(
+            fmt::format("Service at index {} binds ServiceId {} which exceeds the maximum of {}", index, binding.Id.Value, ServiceId::MaxValue));
+        }
+        const std::type_index bindingType(*binding.pType);
+        if (std::find(info.SupportedInterfaces.begin(), info.SupportedInterfaces.end(), bindingType) == info.SupportedInterfaces.end())
+        {
+          throw std::invalid_argument(
+            fmt::format("Service at index {} binds ServiceId {} to unsupported interface {}", index, binding.Id.Value, binding.pType->name()));
+        }
+        // The single RTTI check, lookups by id rely on it and use a static_pointer_cast
+        if (!binding.Bind(info.Service))
+        {
+          throw std::invalid_argument(
+            fmt::format("Service at index {} does not implement {} bound to ServiceId {}", index, binding.pType->name(), binding.Id.Value));
+        }
+
+        const auto isConflict = [&binding, &bindingType](const std::type_info* pType)
+        { return pType != nullptr && std::type_index(*pType) != bindingType; };
+        const bool existingConflict = binding.Id.Value < m_servicesById.size() && isConflict(m_servicesById[binding.Id.Value].pType);
+        const bool groupConflict = std::any_of(newBindings.begin(), newBindings.end(), [&binding, &isConflict](const ServiceIdBinding& other)
+                                               { return other.Id == binding.Id && isConflict(other.pType); });
+        if (existingConflict || groupConflict)
+        {
+          throw std::invalid_argument(
+            fmt::format("Service at index {} binds ServiceId {} to {} but it is already bound to another interface", index, binding.Id.Value,
+                        binding.pType->name()));
+        }
+
+        // Each bucket tracks a single slot, so an interface can only have one id
+        const std::size_t bucketIndex = FindTypeBucket(bindingType);
+        const bool existingIdConflict = bucketIndex != m_typeBuckets.size() && m_typeBuckets[bucketIndex].IdSlot != NoIdSlot &&
+                                        m_typeBuckets[bucketIndex].IdSlot != binding.Id.Value;
+        const bool groupIdConflict = std::any_of(newBindings.begin(), newBindings.end(), [&binding, &bindingType](const ServiceIdBinding& other)
+                                                 { return other.Id != binding.Id && std::type_index(*other.pType) == bindingType; });
+        if (existingIdConflict || groupIdConflict)
+        {
+          throw std::invalid_argument(fmt::format("Service at index {} binds {} to ServiceId {} but it is already bound to another id", index,
+                                                  binding.pType->name(), binding.Id.Value));
+        }
+      }
+    }
+
     /// @brief Validates that the current thread is the owner thread.
     /// @throws ServiceProviderException if called from a different thread.
     void ValidateThreadAccess() const
@@ -64,9 +265,20 @@ namespace Test2
 
   public:
     ManagedThreadServiceProvider()
-      : m_ownerThreadId(std::this_thread::get_id())
+      : m_generation(std::make_shared<ServiceProviderGeneration>())
+      , m_ownerThreadId(std::this_thread::get_id())
     {
     }
+
+    ~ManagedThreadServiceProvider() override
+    {
+      // Handles that outlive the provider must not keep using their cached services
+      m_generation->Value = ServiceProviderGeneration::Expired;
+    }
+
+    ManagedThreadServiceProvider(const ManagedThreadServiceProvider&) = delete;
+    ManagedThreadServiceProvider& operator=(const ManagedThreadServiceProvider&) = delete;
+
     /// @brief Registers a priority group of services.
     ///
     /// Priority groups must be registered in strictly decreasing priority order.
@@ -79,7 +291,7 @@ namespace Test2
     /// @param services The service instance info structs to register (will be moved).
     /// @throws EmptyPriorityGroupException if the services vector is empty.
     /// @throws InvalidPriorityOrderException if priority >= last registered priority.
-    /// @throws std::invalid_argument if any service has no supported interfaces or null service pointer.
+    /// @throws std::invalid_argument if any service has no supported interfaces, a null service pointer or an invalid ServiceId binding.
     void RegisterPriorityGroup(ServiceLaunchPriority priority, std::vector<Test2::ServiceInstanceInfo>&& services)
     {
       if (services.empty())
@@ -99,7 +311,8 @@ namespace Test2
         }
       }
 
-      // Validate each service and build type index
+      // Validate each service
+      std::vector<ServiceIdBinding> newBindings;
       for (size_t i = 0; i < services.size(); ++i)
       {
         if (!services[i].Service)
@@ -110,56 +323,85 @@ namespace Test2
         {
           throw std::invalid_argument(fmt::format("Service at index {} has no supported interfaces", i));
         }
+        ValidateServiceIdBindings(i, services[i], newBindings);
+        newBindings.insert(newBindings.end(), services[i].SupportedServiceIds.begin(), services[i].SupportedServiceIds.end());
+      }
 
-        // Index service by each supported interface type
-        for (const std::type_index& typeIndex : services[i].SupportedInterfaces)
+      PriorityGroup group{priority, std::move(services)};
+      for (const auto& info : group.Services)
+      {
+        m_processList.push_back(info.Service.get());
+        for (const std::type_index& typeIndex : info.SupportedInterfaces)
         {
-          m_servicesByType.emplace(typeIndex, services[i].Service);
+          const std::uint32_t bucketIndex = FindOrAddTypeBucket(typeIndex);
+          m_typeBuckets[bucketIndex].Services.push_back(info.Service);
+          group.TypeBuckets.push_back(bucketIndex);
         }
+        for (const auto& binding : info.SupportedServiceIds)
+        {
+          AddServiceIdBinding(binding);
+        }
+      }
+      for (const std::uint32_t bucketIndex : group.TypeBuckets)
+      {
+        RefreshServiceIdSlot(bucketIndex);
       }
 
-      m_priorityGroups.emplace_back(PriorityGroup{priority, std::move(services)});
+      m_priorityGroups.push_back(std::move(group));
+      ++m_generation->Value;
     }
 
     /// @brief Unregisters services at a specific priority level.
     ///
     /// Removes the priority group from the provider and returns the services.
-    /// Services are removed from the type index as well.
+    /// Services are removed from the type index through the removal handles stored at registration, so the cost follows the size of the
+    /// group rather than the number of registered services.
     ///
     /// @param priority The priority level to unregister.
     /// @return The services that were at that priority level, or empty if not found.
     [[nodiscard]] std::vector<ServiceInstanceInfo> UnregisterPriorityGroup(ServiceLaunchPriority priority)
     {
-      // Find the priority group
-      auto it =
-        std::find_if(m_priorityGroups.begin(), m_priorityGroups.end(), [priority](const PriorityGroup& group) { return group.Priority == priority; });
+      // The groups are sorted by strictly decreasing priority
+      auto it = std::lower_bound(m_priorityGroups.begin(), m_priorityGroups.end(), priority,
+                                 [](const PriorityGroup& group, const ServiceLaunchPriority value) { return group.Priority > value; });
 
-      if (it == m_priorityGroups.end())
+      if (it == m_priorityGroups.end() || it->Priority != priority)
       {
         return {};
       }
 
-      // Remove services from type index
-      for (const auto& info : it->Services)
+      // The group's services are a contiguous range of the process list, located from the back as shutdown removes the last group first
+      std::size_t trailingCount = 0;
+      for (auto itr = it; itr != m_priorityGroups.end(); ++itr)
       {
-        for (const auto& typeIndex : info.SupportedInterfaces)
+        trailingCount += itr->Services.size();
+      }
+      const auto processFirst = m_processList.end() - static_cast<std::ptrdiff_t>(trailingCount);
+      m_processList.erase(processFirst, processFirst + static_cast<std::ptrdiff_t>(it->Services.size()));
+
+      // Walk the removal handles backwards, so a reverse order shutdown finds each service at the back of its bucket
+      std::size_t handle = it->TypeBuckets.size();
+      for (auto infoItr = it->Services.rbegin(); infoItr != it->Services.rend(); ++infoItr)
+      {
+        for (std::size_t i = 0; i < infoItr->SupportedInterfaces.size(); ++i)
+        {
+          auto& bucketServices = m_typeBuckets[it->TypeBuckets[--handle]].Services;
+          const auto found = std::find(bucketServices.rbegin(), bucketServices.rend(), infoItr->Service);
+          bucketServices.erase(std::next(found).base());
+        }
+        for (const auto& binding : infoItr->SupportedServiceIds)
         {
-          // Find and erase the specific service for this type
-          auto range = m_servicesByType.equal_range(typeIndex);
-          for (auto typeIt = range.first; typeIt != range.second; ++typeIt)
-          {
-            if (typeIt->second == info.Service)
-            {
-              m_servicesByType.erase(typeIt);
-              break;
-            }
-          }
+          RemoveServiceIdBinding(binding);
         }
       }
+      for (const std::uint32_t bucketIndex : it->TypeBuckets)
+      {
+        RefreshServiceIdSlot(bucketIndex);
+      }
 
-      // Move services out and remove the priority group
       std::vector<ServiceInstanceInfo> result = std::move(it->Services);
       m_priorityGroups.erase(it);
+      ++m_generation->Value;
       return result;
     }
 
@@ -167,59 +409,67 @@ namespace Test2
     std::shared_ptr<IService> GetService(const std::type_info& type) const override
     {
       ValidateThreadAccess();
-      const std::type_index typeIndex(type);
-      auto range = m_servicesByType.equal_range(typeIndex);
+      const auto services = FindServices(type);
 
-      if (range.first == range.second)
+      if (services.empty())
       {
         throw UnknownServiceException(std::string("No service found for type: ") + type.name());
       }
 
       // Check if there's exactly one service
-      auto it = range.first;
-      auto next = it;
-      ++next;
-
-      if (next != range.second)
+      if (services.size() > 1)
       {
         throw MultipleServicesFoundException(std::string("Multiple services found for type: ") + type.name() +
                                              ". Use TryGetServices to retrieve all matching services.");
       }
 
-      return it->second;
+      return services.front();
     }
 
     std::shared_ptr<IService> TryGetService(const std::type_info& type) const override
     {
       ValidateThreadAccess();
-      const std::type_index typeIndex(type);
-      auto it = m_servicesByType.find(typeIndex);
+      const auto services = FindServices(type);
 
-      if (it == m_servicesByType.end())
+      if (services.empty())
       {
         return nullptr;
       }
 
-      return it->second;
+      return services.front();
     }
 
     bool TryGetServices(const std::type_info& type, std::vector<std::shared_ptr<IService>>& rServices) const override
     {
       ValidateThreadAccess();
-      const std::type_index typeIndex(type);
-      auto range = m_servicesByType.equal_range(typeIndex);
+      const auto services = FindServices(type);
 
-      if (range.first == range.second)
+      if (services.empty())
       {
         return false;
       }
 
-      for (auto it = range.first; it != range.second; ++it)
+      rServices.insert(rServices.end(), services.begin(), services.end());
+
+      return true;
+    }
+
+    std::shared_ptr<IService> TryGetUniqueService(const ServiceId id, const std::type_info& type) const override
+    {
+      ValidateThreadAccess();
+      if (id.Value >= m_servicesById.size())
       {
-        rServices.push_back(it->second);
+        return nullptr;
       }
+      // An address compare keeps RTTI out of the lookup, a type_info duplicated across modules only costs the fallback
+      const auto& slot = m_servicesById[id.Value];
+      return slot.pType == &type ? slot.Service : nullptr;
+    }
 
-      return true;
+    std::shared_ptr<const ServiceProviderGeneration> GetGeneration() const override
+    {
+      ValidateThreadAccess();
+      return m_generation;
     }
 
     /// @brief Get the total count of registered services.
@@ -265,6 +515,19 @@ namespace Test2
 
       return result;
     }
+
+    /// @brief Get all registered service controls for the process tick.
+    ///
+    /// Returns the services in registration order from a list that only changes when a priority group is
+    /// registered or unregistered, so iterating it does not allocate or change reference counts.
+    ///
+    /// @return A view of the services, valid until the next RegisterPriorityGroup or UnregisterPriorityGroup call.
+    /// @note The services must not (un)register priority groups from inside the loop that iterates the view.
+    [[nodiscard]] std::span<IServiceControl* const> GetProcessList() const
+    {
+      ValidateThreadAccess();
+      return m_processList;
+    }
   };
 }
 
@@ -19,9 +19,12 @@
 #include <Test2/Framework/Host/IThreadSafeServiceHost.hpp>
 #include <Test2/Framework/Host/Managed/ManagedThreadServiceProvider.hpp>
 #include <Test2/Framework/Host/ServiceInstanceInfo.hpp>
+#include <Test2/Framework/Host/ServiceProcessSchedule.hpp>
+#include <Test2/Framework/Host/ServiceProcessTiming.hpp>
 #include <Test2/Framework/Host/StartServiceRecord.hpp>
 #include <Test2/Framework/Lifecycle/ILifeTracker.hpp>
 #include <Test2/Framework/Provider/ServiceProvider.hpp>
+#include <Test2/Framework/Provider/ServiceProviderGeneration.hpp>
 #include <Test2/Framework/Provider/ServiceProviderProxy.hpp>
 #include <Test2/Framework/Registry/ServiceLaunchPriority.hpp>
 #include <Test2/Framework/Service/IServiceControl.hpp>
@@ -32,6 +35,8 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/use_awaitable.hpp>
 #include <spdlog/spdlog.h>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -52,6 +57,11 @@ namespace Test2
   {
     std::thread::id m_ownerThreadId;
     bool m_shutdownRequested{false};
+    ServiceProcessSchedule m_processSchedule;
+    /// @brief The provider generation m_processSchedule was built for.
+    std::uint64_t m_processScheduleGeneration{ServiceProviderGeneration::Expired};
+    bool m_processTimingEnabled{false};
+    std::shared_ptr<const ServiceProviderGeneration> m_providerGeneration;
 
   protected:
     boost::asio::io_context m_ioContext;
@@ -115,6 +125,48 @@ namespace Test2
       m_shutdownRequested = true;
     }
 
+    /// @brief Enable or disable measuring the duration of every service Process() call.
+    ///
+    /// Disabled by default. While enabled each call costs one steady_clock read and a histogram update, the recorded durations
+    /// are available through GetProcessTimings(). Disabling it discards them.
+    /// @throws WrongThreadException if called from a thread other than the owner thread.
+    void SetProcessTimingEnabled(const bool enabled)
+    {
+      ValidateThreadAccess();
+      if (enabled != m_processTimingEnabled)
+      {
+        m_processTimingEnabled = enabled;
+        // The schedule picks up the change when it is rebuilt on the next tick
+        m_processScheduleGeneration = ServiceProviderGeneration::Expired;
+      }
+    }
+
+    [[nodiscard]] bool IsProcessTimingEnabled() const noexcept
+    {
+      return m_processTimingEnabled;
+    }
+
+    /// @brief Get the Process() call count and p50/p99/max durations of every processed service, in registration order.
+    ///
+    /// Services appear once the first tick after they were registered (or timing was enabled) has run, services that are never
+    /// processed are not listed.
+    /// @return The timings, empty while timing is disabled.
+    /// @throws WrongThreadException if called from a thread other than the owner thread.
+    [[nodiscard]] std::vector<ServiceProcessTiming> GetProcessTimings() const
+    {
+      ValidateThreadAccess();
+      // A disabled schedule only drops its timings on the next rebuild
+      return m_processTimingEnabled ? m_processSchedule.GetTimings() : std::vector<ServiceProcessTiming>{};
+    }
+
+    /// @brief Clear the recorded Process() timings without disabling timing.
+    /// @throws WrongThreadException if called from a thread other than the owner thread.
+    void ResetProcessTimings()
+    {
+      ValidateThreadAccess();
+      m_processSchedule.ResetTimings();
+    }
+
     /// @brief Implementation of service startup logic.
     /// @param services Services to start.
     /// @param currentPriority Priority level for this group.
@@ -213,6 +265,7 @@ namespace Test2
       : m_ownerThreadId(std::this_thread::get_id())
       , m_provider(std::make_shared<ManagedThreadServiceProvider>())
     {
+      m_providerGeneration = m_provider->GetGeneration();
       spdlog::trace("ServiceHostBase Created at {}", m_ownerThreadId);
     }
 
@@ -228,24 +281,30 @@ namespace Test2
       }
     }
 
-    /// @brief Process all registered services and aggregate their results.
+    /// @brief Process the registered services that are due and aggregate their results.
     ///
-    /// Iterates through all services registered with the provider and calls Process()
-    /// on each one, merging the results according to ProcessResult priority rules.
+    /// Calls Process() on the services whose ServiceTickPolicy makes them due, merging the results according to
+    /// ProcessResult priority rules. The schedule is only rebuilt when the provider's registrations changed.
     ///
-    /// @return Aggregated ProcessResult from all services.
+    /// @return Aggregated ProcessResult from the processed services, limited by the next periodic service.
     ProcessResult DoProcessServices()
     {
       ValidateThreadAccess();
-      ProcessResult result = ProcessResult::NoSleepLimit();
 
-      auto allServices = m_provider->GetAllServiceControls();
-      for (const auto& service : allServices)
+      // Registrations only change from coroutines running on m_ioContext, never from inside Process(), so the schedule stays valid
+      const bool rebuild = m_providerGeneration->Value != m_processScheduleGeneration;
+      if (!rebuild && !m_processSchedule.HasPeriodicServices())
       {
-        result = Merge(result, service->Process());
+        return m_processSchedule.Process(ServiceProcessSchedule::Clock::time_point{});
       }
 
-      return result;
+      const auto now = ServiceProcessSchedule::Clock::now();
+      if (rebuild)
+      {
+        m_processSchedule.Rebuild(m_provider->GetProcessList(), now, m_processTimingEnabled);
+        m_processScheduleGeneration = m_providerGeneration->Value;
+      }
+      return m_processSchedule.Process(now);
     }
 
     std::size_t DoPoll()
@@ -326,6 +385,8 @@ namespace Test2
         {
           record.InstanceInfo.SupportedInterfaces.push_back(typeIndex);
         }
+        auto supportedServiceIds = serviceRecord.Factory->GetSupportedServiceIds();
+        record.InstanceInfo.SupportedServiceIds.assign(supportedServiceIds.begin(), supportedServiceIds.end());
 
         initRecords.push_back(std::move(record));
       }
@@ -32,17 +32,17 @@ namespace Test2
   boost::asio::awaitable<void> ServiceHostProxy::TryStartServicesAsync(std::vector<StartServiceRecord> services,
                                                                        const ServiceLaunchPriority currentPriority)
   {
-    co_await Util::InvokeAsync<kProxyName>(m_dispatchContext, &ServiceHostBase::TryStartServicesAsync, std::move(services), currentPriority);
+    return Util::InvokeAsync<kProxyName>(m_dispatchContext, &ServiceHostBase::TryStartServicesAsync, std::move(services), currentPriority);
   }
 
   boost::asio::awaitable<std::vector<std::exception_ptr>> ServiceHostProxy::TryShutdownServicesAsync(const ServiceLaunchPriority priority)
   {
-    co_return co_await Util::InvokeAsync<kProxyName>(m_dispatchContext, &ServiceHostBase::TryShutdownServicesAsync, priority);
+    return Util::InvokeAsync<kProxyName>(m_dispatchContext, &ServiceHostBase::TryShutdownServicesAsync, priority);
   }
 
   boost::asio::awaitable<bool> ServiceHostProxy::TryRequestShutdownAsync()
   {
-    co_return co_await Util::TryInvokeAsync<kProxyName>(m_dispatchContext, &ServiceHostBase::RequestShutdown);
+    return Util::TryInvokeAsync<kProxyName>(m_dispatchContext, &ServiceHostBase::RequestShutdown);
   }
 
   bool ServiceHostProxy::TryRequestShutdown() noexcept
@@ -50,4 +50,14 @@ namespace Test2
     return Util::TryInvokePost(m_dispatchContext.GetTargetContext(), &ServiceHostBase::RequestShutdown);
   }
 
+  boost::asio::awaitable<void> ServiceHostProxy::SetProcessTimingEnabledAsync(const bool enabled)
+  {
+    return Util::InvokeAsync<kProxyName>(m_dispatchContext, &ServiceHostBase::SetProcessTimingEnabled, enabled);
+  }
+
+  boost::asio::awaitable<std::vector<ServiceProcessTiming>> ServiceHostProxy::GetProcessTimingsAsync()
+  {
+    return Util::InvokeAsync<kProxyName>(m_dispatchContext, &ServiceHostBase::GetProcessTimings);
+  }
+
 }
@@ -0,0 +1,251 @@
+#ifndef SERVICE_FRAMEWORK_TEST2_FRAMEWORK_HOST_SERVICEPROCESSSCHEDULE_HPP
+#define SERVICE_FRAMEWORK_TEST2_FRAMEWORK_HOST_SERVICEPROCESSSCHEDULE_HPP
+//****************************************************************************************************************************************************
+//* Zero-Clause BSD (0BSD)
+//*
+//* Copyright (c) 2025, Mana Battery
+//*
+//* Permission to use, copy, modify, and/or distribute this software for any purpose with or without fee is hereby granted.
+//*
+//* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//****************************************************************************************************************************************************
+
+
+#include <Test2/Framework/Host/ServiceProcessTiming.hpp>
+#include <Test2/Framework/Service/IServiceControl.hpp>
+#include <Test2/Framework/Service/ProcessResult.hpp>
+#include <Test2/Framework/Service/ServiceTickPolicy.hpp>
+#include <Test2/Framework/Util/LatencyHistogram.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace Test2
+{
+  /// @brief Decides which services are ticked by ServiceHostBase::DoProcessServices.
+  ///
+  /// Services are sorted by their ServiceTickPolicy when the schedule is rebuilt: Never services are dropped, EveryTick services are
+  /// processed on every call and Periodic services live in a min-heap ordered by their next due time, so a tick only touches the
+  /// services that are due. The heap head also limits the merged sleep hint.
+  ///
+  /// When rebuilt with timing enabled the duration of every Process() call is recorded in a per-service Util::LatencyHistogram. The
+  /// timestamps are chained, so the few instructions of scheduling between two calls are counted towards the second one. Without
+  /// timing the tick takes no timestamps beyond the one the caller passes in.
+  class ServiceProcessSchedule
+  {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+  private:
+    struct ScheduledService
+    {
+      IServiceControl* pService;
+      /// @brief The index into m_timings, only meaningful while m_measureTiming is set.
+      std::uint32_t TimingIndex;
+    };
+
+    struct PeriodicEntry
+    {
+      Clock::time_point Due;
+      std::chrono::nanoseconds Period;
+      IServiceControl* pService;
+      std::uint32_t TimingIndex;
+    };
+
+    struct TimingRecord
+    {
+      IServiceControl* pService;
+      /// @brief Captured while the service is known to be alive, so a snapshot never touches a service that was unregistered.
+      std::type_index ServiceType;
+      Util::LatencyHistogram Histogram{};
+    };
+
+    /// @brief Orders the heap so the earliest due time is at the front.
+    static bool IsDueLater(const PeriodicEntry& lhs, const PeriodicEntry& rhs) noexcept
+    {
+      return lhs.Due > rhs.Due;
+    }
+
+    std::vector<ScheduledService> m_everyTick;
+    std::vector<PeriodicEntry> m_periodic;
+    /// @brief One record per scheduled service in registration order, empty unless m_measureTiming is set.
+    std::vector<TimingRecord> m_timings;
+    bool m_measureTiming{false};
+
+  public:
+    /// @brief Rebuilds the schedule for the given services, in their registration order.
+    ///
+    /// Periodic services that were already scheduled keep their due time, new ones are due immediately. Likewise the timings of services
+    /// that stay scheduled are kept, the timings of services that are gone are dropped.
+    ///
+    /// @param services The registered services, GetTickPolicy() is queried once per service.
+    /// @param now The current time.
+    /// @param measureTiming Record the duration of every Process() call until the next rebuild.
+    void Rebuild(std::span<IServiceControl* const> services, const Clock::time_point now, const bool measureTiming = false)
+    {
+      // Sorted by service so the previous due times and timings can be looked up
+      std::vector<PeriodicEntry> previous = std::move(m_periodic);
+      std::sort(previous.begin(), previous.end(), [](const PeriodicEntry& lhs, const PeriodicEntry& rhs) { return lhs.pService < rhs.pService; });
+      std::vector<TimingRecord> previousTimings = std::move(m_timings);
+      std::sort(previousTimings.begin(), previousTimings.end(),
+                [](const TimingRecord& lhs, const TimingRecord& rhs) { return lhs.pService < rhs.pService; });
+
+      m_everyTick.clear();
+      m_periodic.clear();
+      m_timings.clear();
+      m_measureTiming = measureTiming;
+      std::uint32_t timingIndex = 0;
+      for (IServiceControl* pService : services)
+      {
+        const ServiceTickPolicy policy = pService->GetTickPolicy();
+        switch (policy.Mode)
+        {
+        case ServiceTickMode::Never:
+          continue;
+        case ServiceTickMode::Periodic:
+          if (policy.Period > std::chrono::nanoseconds::zero())
+          {
+            auto itr = std::lower_bound(previous.begin(), previous.end(), pService,
+                                        [](const PeriodicEntry& entry, const IServiceControl* pValue) { return entry.pService < pValue; });
+            const bool wasScheduled = itr != previous.end() && itr->pService == pService;
+            m_periodic.push_back(PeriodicEntry{wasScheduled ? itr->Due : now, policy.Period, pService, timingIndex});
+            break;
+          }
+          [[fallthrough]];
+        case ServiceTickMode::EveryTick:
+        default:
+          m_everyTick.push_back(ScheduledService{pService, timingIndex});
+          break;
+        }
+
+        if (measureTiming)
+        {
+          auto itr = std::lower_bound(previousTimings.begin(), previousTimings.end(), pService,
+                                      [](const TimingRecord& record, const IServiceControl* pValue) { return record.pService < pValue; });
+          // The type check catches most of the cases where a new service reuses the address of an unregistered one
+          const std::type_index serviceType(typeid(*pService));
+          if (itr != previousTimings.end() && itr->pService == pService && itr->ServiceType == serviceType)
+          {
+            m_timings.push_back(std::move(*itr));
+          }
+          else
+          {
+            m_timings.push_back(TimingRecord{pService, serviceType});
+          }
+        }
+        ++timingIndex;
+      }
+      std::make_heap(m_periodic.begin(), m_periodic.end(), IsDueLater);
+    }
+
+    /// @brief Checks if any service is scheduled periodically, only then does Process need the current time.
+    [[nodiscard]] bool HasPeriodicServices() const noexcept
+    {
+      return !m_periodic.empty();
+    }
+
+    /// @brief Get the number of services Process() can ever call.
+    [[nodiscard]] std::size_t GetScheduledCount() const noexcept
+    {
+      return m_everyTick.size() + m_periodic.size();
+    }
+
+    /// @brief Checks if the last Rebuild enabled timing.
+    [[nodiscard]] bool IsMeasuringTiming() const noexcept
+    {
+      return m_measureTiming;
+    }
+
+    /// @brief Get the Process() timings of the scheduled services in registration order, empty unless timing is measured.
+    [[nodiscard]] std::vector<ServiceProcessTiming> GetTimings() const
+    {
+      std::vector<ServiceProcessTiming> timings;
+      timings.reserve(m_timings.size());
+      for (const TimingRecord& record : m_timings)
+      {
+        timings.push_back(ServiceProcessTiming{record.ServiceType, record.Histogram.GetCount(), record.Histogram.GetPercentile(50.0),
+                                               record.Histogram.GetPercentile(99.0), record.Histogram.GetMax()});
+      }
+      return timings;
+    }
+
+    /// @brief Clears the recorded timings, the services stay scheduled.
+    void ResetTimings() noexcept
+    {
+      for (TimingRecord& record : m_timings)
+      {
+        record.Histogram.Reset();
+      }
+    }
+
+    /// @brief Processes the EveryTick services and the Periodic services that are due.
+    /// @param now The current time, only used when HasPeriodicServices() is true.
+    /// @return The merged ProcessResult, limited to the time until the next periodic service is due.
+    ProcessResult Process(const Clock::time_point now)
+    {
+      return m_measureTiming ? DoProcess<true>(now) : DoProcess<false>(now);
+    }
+
+  private:
+    template <bool MeasureTiming>
+    ProcessResult DoProcess(const Clock::time_point now)
+    {
+      // The end of one measured call is the start of the next, so each call costs a single clock read
+      Clock::time_point lastTime = MeasureTiming ? Clock::now() : Clock::time_point{};
+      ProcessResult result = ProcessResult::NoSleepLimit();
+      for (const ScheduledService& entry : m_everyTick)
+      {
+        result = Merge(result, ProcessService<MeasureTiming>(entry.pService, entry.TimingIndex, lastTime));
+      }
+
+      if (m_periodic.empty())
+      {
+        return result;
+      }
+
+      while (m_periodic.front().Due <= now)
+      {
+        std::pop_heap(m_periodic.begin(), m_periodic.end(), IsDueLater);
+        PeriodicEntry& entry = m_periodic.back();
+        result = Merge(result, ProcessService<MeasureTiming>(entry.pService, entry.TimingIndex, lastTime));
+
+        // Keep the cadence, but a service that fell behind is not ticked repeatedly to catch up
+        entry.Due += entry.Period;
+        if (entry.Due <= now)
+        {
+          entry.Due = now + entry.Period;
+        }
+        std::push_heap(m_periodic.begin(), m_periodic.end(), IsDueLater);
+      }
+      return Merge(result, ProcessResult::SleepLimit(m_periodic.front().Due - now));
+    }
+
+    /// @param rLastTime The time the previous measured call ended, updated to the time this one ended.
+    template <bool MeasureTiming>
+    ProcessResult ProcessService(IServiceControl* const pService, const std::uint32_t timingIndex, Clock::time_point& rLastTime)
+    {
+      if constexpr (MeasureTiming)
+      {
+        const ProcessResult result = pService->Process();
+        const auto endTime = Clock::now();
+        m_timings[timingIndex].Histogram.Record(endTime - rLastTime);
+        rLastTime = endTime;
+        return result;
+      }
+      else
+      {
+        return pService->Process();
+      }
+    }
+  };
+}
+
+#endif
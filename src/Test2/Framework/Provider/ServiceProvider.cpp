@@ -54,4 +54,25 @@ namespace Test2
     }
     return provider->TryGetServices(type, rServices);
   }
+
+  std::shared_ptr<IService> ServiceProvider::TryGetUniqueService(const ServiceId id, const std::type_info& type) const
+  {
+    auto provider = m_provider.lock();
+    if (!provider)
+    {
+      // Not logged here, the type based lookup the caller falls back to reports it
+      return nullptr;
+    }
+    return provider->TryGetUniqueService(id, type);
+  }
+
+  std::shared_ptr<const ServiceProviderGeneration> ServiceProvider::GetGeneration() const
+  {
+    auto provider = m_provider.lock();
+    if (!provider)
+    {
+      return nullptr;
+    }
+    return provider->GetGeneration();
+  }
 }
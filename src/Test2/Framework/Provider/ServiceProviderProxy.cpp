@@ -55,4 +55,22 @@ namespace Test2
     }
     return m_provider->TryGetServices(type, rServices);
   }
+
+  std::shared_ptr<IService> ServiceProviderProxy::TryGetUniqueService(const ServiceId id, const std::type_info& type) const
+  {
+    if (!m_provider)
+    {
+      return nullptr;
+    }
+    return m_provider->TryGetUniqueService(id, type);
+  }
+
+  std::shared_ptr<const ServiceProviderGeneration> ServiceProviderProxy::GetGeneration() const
+  {
+    if (!m_provider)
+    {
+      return nullptr;
+    }
+    return m_provider->GetGeneration();
+  }
 }